@@ -930,6 +930,7 @@ private:
 
   // These do register sized moves/scans
   void rep_mov();
+  void rep_movsb();
   void rep_stos();
   void rep_stosb();
   void repne_scan();
@@ -1736,10 +1737,14 @@ private:
 
   // Multiply add
   void pmaddwd(XMMRegister dst, XMMRegister src);
+  void pmaddubsw(XMMRegister dst, XMMRegister src);
   void vpmaddwd(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
   // Multiply add accumulate
   void evpdpwssd(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
 
+  // Sum of absolute differences of packed unsigned bytes
+  void psadbw(XMMRegister dst, XMMRegister src);
+
 #ifndef _LP64 // no 32bit push/pop on amd64
   void popl(Address dst);
 #endif
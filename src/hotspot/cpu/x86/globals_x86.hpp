@@ -216,6 +216,11 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              "compare operations can also use AVX512 intrinsics.")          \
              range(0, max_jint)                                             \
                                                                             \
+  diagnostic(int, RepMovsbThreshold, 2048,                                  \
+             "Minimum size in bytes to use fast-string rep movsb for "      \
+             "disjoint byte copies. Zero disables it.")                     \
+             range(0, max_jint)                                             \
+                                                                            \
   diagnostic(bool, IntelJccErratumMitigation, true,                         \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")
@@ -1512,7 +1512,7 @@ class StubGenerator: public StubCodeGenerator {
     address start = __ pc();
 
     Label L_copy_bytes, L_copy_8_bytes, L_copy_4_bytes, L_copy_2_bytes;
-    Label L_copy_byte, L_exit;
+    Label L_copy_byte, L_rep_movsb, L_exit;
     const Register from        = rdi;  // source array address
     const Register to          = rsi;  // destination array address
     const Register count       = rdx;  // elements count
@@ -1540,6 +1540,10 @@ class StubGenerator: public StubCodeGenerator {
       UnsafeCopyMemoryMark ucmm(this, !aligned, true);
       // 'from', 'to' and 'count' are now valid
       __ movptr(byte_count, count);
+      if (RepMovsbThreshold > 0) {
+        __ cmpptr(byte_count, RepMovsbThreshold);
+        __ jcc(Assembler::aboveEqual, L_rep_movsb);
+      }
       __ shrptr(count, 3); // count => qword_count
 
       // Copy from low to high addresses.  Use 'to' as scratch.
@@ -1596,6 +1600,16 @@ class StubGenerator: public StubCodeGenerator {
       // Copy in multi-bytes chunks
       copy_bytes_forward(end_from, end_to, qword_count, rax, L_copy_bytes, L_copy_8_bytes);
       __ jmp(L_copy_4_bytes);
+
+      if (RepMovsbThreshold > 0) {
+        // Large copies on fast-string CPUs. Byte copies need no element
+        // atomicity, and the stores of a string operation stay ordered with
+        // the stores before and after it, so no fence is needed.
+      __ BIND(L_rep_movsb);
+        __ xchgptr(from, to); // rep movsb copies [rsi] => [rdi], count in rcx
+        __ rep_movsb();
+        __ jmp(L_exit);
+      }
     }
     return start;
   }
@@ -5408,6 +5422,172 @@ address generate_avx_ghash_processBlocks() {
       return start;
   }
 
+  address generate_adler32_table() {
+    __ align(16);
+    StubCodeMark mark(this, "StubRoutines", "adler32_table");
+    address start = __ pc();
+    // byte weights 16, 15, ..., 1 for pmaddubsw
+    __ emit_data64(0x090a0b0c0d0e0f10, relocInfo::none);
+    __ emit_data64(0x0102030405060708, relocInfo::none);
+    // word ones for pmaddwd
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    return start;
+  }
+
+  // s = s % BASE, for any 32-bit s, using 2^16 == 15 (mod BASE)
+  void adler32_mod(Register s, Register tmp) {
+    for (int i = 0; i < 2; i++) {
+      __ movl(tmp, s);
+      __ shrl(tmp, 16);
+      __ imull(tmp, tmp, 15);
+      __ andl(s, 0xffff);
+      __ addl(s, tmp);
+    }
+    __ movl(tmp, s);
+    __ subl(tmp, 0xfff1);
+    __ cmovl(Assembler::aboveEqual, s, tmp);
+  }
+
+  // dst = sum of the four dwords of src; clobbers src and xtmp
+  void adler32_hsum(Register dst, XMMRegister src, XMMRegister xtmp) {
+    __ pshufd(xtmp, src, 0x4E);
+    __ paddd(src, xtmp);
+    __ pshufd(xtmp, src, 0xB1);
+    __ paddd(src, xtmp);
+    __ movdl(dst, src);
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buff
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int adler result
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need SSSE3 instructions");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+
+    address start = __ pc();
+
+    Label L_nmax_loop, L_by16_loop, L_by1, L_by1_loop, L_combine;
+
+    const Register adler = c_rarg0;
+    const Register buff  = c_rarg1;
+    const Register len   = c_rarg2;
+    const Register s1    = rax;
+    const Register s2    = r11;
+    const Register count = r9;
+    const Register tmp   = r10;
+    assert_different_registers(adler, buff, len, s1, s2, count, tmp);
+
+    const XMMRegister xzero = xmm0;
+    const XMMRegister xtaps = xmm1;
+    const XMMRegister xones = xmm2;
+    const XMMRegister xs1   = xmm3;
+    const XMMRegister xs2   = xmm4;
+    const XMMRegister xps   = xmm5;
+    const XMMRegister xdata = xmm6;
+    const XMMRegister xtmp  = xmm7;
+
+    // Largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1; a multiple of 16.
+    const int NMAX = 5552;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movdqu(xtaps, ExternalAddress(StubRoutines::x86::adler32_table_addr()));
+    __ movdqu(xones, ExternalAddress(StubRoutines::x86::adler32_table_addr() + 16));
+    __ pxor(xzero, xzero);
+
+    __ movl(s2, adler);
+    __ shrl(s2, 16);
+    __ movl(s1, adler);
+    __ andl(s1, 0xffff);
+
+    __ cmpl(len, 16);
+    __ jcc(Assembler::below, L_by1);
+
+    // Process min(len, NMAX) bytes, rounded down to 16, before reducing mod BASE.
+    // For a chunk of n bytes: s2 += n * s1 + sum((n - i) * b[i]), s1 += sum(b[i]).
+    // Per 16-byte block the weights (16 - i) come from pmaddubsw, the block sum
+    // from psadbw, and xps collects the block sums of all earlier blocks, each
+    // of which is weighted by another 16 for every later block.
+    __ bind(L_nmax_loop);
+    __ movl(count, NMAX);
+    __ cmpl(len, count);
+    __ cmovl(Assembler::below, count, len);
+    __ andl(count, ~15);
+    __ subl(len, count);
+
+    __ movl(tmp, s1);
+    __ imull(tmp, count);
+    __ addl(s2, tmp);
+
+    __ pxor(xs1, xs1);
+    __ pxor(xs2, xs2);
+    __ pxor(xps, xps);
+
+    __ bind(L_by16_loop);
+    __ movdqu(xdata, Address(buff, 0));
+    __ movdqu(xtmp, xdata);
+    __ psadbw(xtmp, xzero);
+    __ paddd(xps, xs1);
+    __ paddd(xs1, xtmp);
+    __ pmaddubsw(xdata, xtaps);
+    __ pmaddwd(xdata, xones);
+    __ paddd(xs2, xdata);
+    __ addptr(buff, 16);
+    __ subl(count, 16);
+    __ jcc(Assembler::notZero, L_by16_loop);
+
+    __ pslld(xps, 4);
+    __ paddd(xs2, xps);
+    adler32_hsum(tmp, xs1, xtmp);
+    __ addl(s1, tmp);
+    adler32_hsum(tmp, xs2, xtmp);
+    __ addl(s2, tmp);
+
+    adler32_mod(s1, tmp);
+    adler32_mod(s2, tmp);
+
+    __ cmpl(len, 16);
+    __ jcc(Assembler::aboveEqual, L_nmax_loop);
+
+    // Remaining 0..15 bytes
+    __ bind(L_by1);
+    __ testl(len, len);
+    __ jcc(Assembler::zero, L_combine);
+
+    __ bind(L_by1_loop);
+    __ movzbl(tmp, Address(buff, 0));
+    __ addl(s1, tmp);
+    __ addl(s2, s1);
+    __ addptr(buff, 1);
+    __ subl(len, 1);
+    __ jcc(Assembler::notZero, L_by1_loop);
+
+    adler32_mod(s1, tmp);
+    adler32_mod(s2, tmp);
+
+    __ bind(L_combine);
+    __ shll(s2, 16);
+    __ orl(s1, s2);   // result in rax
+
+    __ vzeroupper();
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   /**
    *  Arguments:
    *
@@ -6380,6 +6560,12 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_crc32c_table_addr = (address)StubRoutines::x86::_crc32c_table;
       StubRoutines::_updateBytesCRC32C = generate_updateBytesCRC32C(supports_clmul);
     }
+
+    if (UseAdler32Intrinsics) {
+      StubRoutines::x86::_adler32_table_addr = generate_adler32_table();
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+
     if (UseLibmIntrinsic && InlineIntrinsics) {
       if (vmIntrinsics::is_intrinsic_available(vmIntrinsics::_dsin) ||
           vmIntrinsics::is_intrinsic_available(vmIntrinsics::_dcos) ||
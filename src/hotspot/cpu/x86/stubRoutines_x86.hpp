@@ -115,6 +115,9 @@ class x86 {
   //shuffle mask for big-endian 128-bit integers
   static address _counter_shuffle_mask_addr;
 
+  // byte weights and word ones for the Adler32 stub
+  static address _adler32_table_addr;
+
   static address _method_entry_barrier;
 
   // masks and table for CRC32
@@ -214,6 +217,7 @@ class x86 {
   static address verify_mxcsr_entry()    { return _verify_mxcsr_entry; }
   static address key_shuffle_mask_addr() { return _key_shuffle_mask_addr; }
   static address counter_shuffle_mask_addr() { return _counter_shuffle_mask_addr; }
+  static address adler32_table_addr()    { return _adler32_table_addr; }
   static address crc_by128_masks_addr()  { return (address)_crc_by128_masks; }
 #ifdef _LP64
   static address crc_by128_masks_avx512_addr()  { return (address)_crc_by128_masks_avx512; }
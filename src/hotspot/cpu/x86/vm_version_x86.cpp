@@ -989,6 +989,14 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseSHA, false);
   }
 
+#ifdef _LP64
+  // The Adler32 stub is only generated on 64-bit
+  if (supports_ssse3()) {
+    if (FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+      FLAG_SET_DEFAULT(UseAdler32Intrinsics, true);
+    }
+  } else
+#endif
   if (UseAdler32Intrinsics) {
     warning("Adler32Intrinsics not available on this CPU.");
     FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
@@ -1491,6 +1499,12 @@ void VM_Version::get_processor_features() {
     warning("fast-string operations are not available on this CPU");
     FLAG_SET_DEFAULT(UseFastStosb, false);
   }
+  if (!supports_erms() && RepMovsbThreshold > 0) {
+    if (!FLAG_IS_DEFAULT(RepMovsbThreshold)) {
+      warning("fast-string operations are not available on this CPU");
+    }
+    FLAG_SET_DEFAULT(RepMovsbThreshold, 0);
+  }
 
   // Use XMM/YMM MOVDQU instruction for Object Initialization
   if (!UseFastStosb && UseSSE >= 2 && UseUnalignedLoadStores) {
@@ -1486,6 +1486,7 @@ size_t os::Posix::get_initial_stack_size(ThreadType thr_type, size_t req_stack_s
   case os::pgc_thread:
   case os::cgc_thread:
   case os::watcher_thread:
+  case os::asynclog_thread:
   default:  // presume the unknown thr_type is a VM internal
     if (req_stack_size == 0 && VMThreadStackSize > 0) {
       // no requested size and we have a more specific default value
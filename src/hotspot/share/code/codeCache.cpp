@@ -55,6 +55,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timerTrace.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/align.hpp"
@@ -203,6 +204,11 @@ void CodeCache::initialize_heaps() {
   // Initial size of constant table (this may be increased if a compiled method needs more space)
   code_buffers_size += c2_count * C2Compiler::initial_code_buffer_size();
 #endif
+  // The default non_nmethod_size covers the default inline cache buffer
+  // (see InlineCacheBuffer::initialize()), but not a larger one set by the user
+  if (!FLAG_IS_DEFAULT(InlineCacheBufferSize)) {
+    code_buffers_size += InlineCacheBufferSize;
+  }
 
   // Increase default non_nmethod_size to account for compiler buffers
   if (!non_nmethod_set) {
@@ -961,6 +967,7 @@ void CodeCache::initialize() {
 }
 
 void codeCache_init() {
+  TraceTime timer("Initialize code cache", TRACETIME_LOG(Info, startuptime));
   CodeCache::initialize();
   // Load AOT libraries and add AOT code heaps.
   AOTLoader::initialize();
@@ -368,6 +368,7 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  update_perf_size();
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -380,8 +381,13 @@ void CompileQueue::add(CompileTask* task) {
     task->log_task_queued();
   }
 
-  // Notify CompilerThreads that a task is available.
-  MethodCompileQueue_lock->notify_all();
+  // Notify CompilerThreads that a task is available. The compiler threads
+  // of all queues wait on MethodCompileQueue_lock, so only wake them up if
+  // a thread of this queue is actually waiting. While all compiler threads
+  // are busy, e.g. during warmup, adding tasks does not cause any wakeups.
+  if (_waiting_threads > 0) {
+    MethodCompileQueue_lock->notify_all();
+  }
 }
 
 /**
@@ -442,7 +448,9 @@ CompileTask* CompileQueue::get() {
     // We need a timed wait here, since compiler threads can exit if compilation
     // is disabled forever. We use 5 seconds wait time; the exiting of compiler threads
     // is not critical and we do not want idle compiler threads to wake up too often.
+    _waiting_threads++;
     locker.wait(5*1000);
+    _waiting_threads--;
 
     if (UseDynamicNumberOfCompilerThreads && _first == NULL) {
       // Still nothing to compile. Give caller a chance to stop this thread.
@@ -517,6 +525,12 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  update_perf_size();
+}
+
+void CompileQueue::create_perf_counters(const char* counter_name, TRAPS) {
+  assert(UsePerfData, "sanity");
+  _perf_size = PerfDataManager::create_variable(SUN_CI, counter_name, PerfData::U_Events, CHECK);
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -955,6 +969,12 @@ void CompileBroker::init_compiler_sweeper_threads() {
 
   if (UsePerfData) {
     PerfDataManager::create_constant(SUN_CI, "threads", PerfData::U_Bytes, _c1_count + _c2_count, CHECK);
+    if (_c2_compile_queue != NULL) {
+      _c2_compile_queue->create_perf_counters("c2QueueSize", CHECK);
+    }
+    if (_c1_compile_queue != NULL) {
+      _c1_compile_queue->create_perf_counters("c1QueueSize", CHECK);
+    }
   }
 
   if (MethodFlushing) {
@@ -89,6 +89,18 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Number of compiler threads waiting in get() for a task to be added.
+  int _waiting_threads;
+
+  // Current queue length, published for external monitoring (UsePerfData).
+  PerfVariable* _perf_size;
+
+  void update_perf_size() {
+    if (_perf_size != NULL) {
+      _perf_size->set_value(_size);
+    }
+  }
+
   void purge_stale_tasks();
  public:
   CompileQueue(const char* name) {
@@ -96,9 +108,13 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _waiting_threads = 0;
     _first_stale = NULL;
+    _perf_size = NULL;
   }
 
+  void         create_perf_counters(const char* counter_name, TRAPS);
+
   const char*  name() const                      { return _name; }
 
   void         add(CompileTask* task);
@@ -62,6 +62,7 @@
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1ThreadLocalData.hpp"
 #include "gc/g1/g1Trace.hpp"
+#include "gc/g1/g1UncommitRegionThread.hpp"
 #include "gc/g1/g1YCTypes.hpp"
 #include "gc/g1/g1YoungRemSetSamplingThread.hpp"
 #include "gc/g1/g1VMOperations.hpp"
@@ -1410,6 +1411,18 @@ void G1CollectedHeap::shrink(size_t shrink_bytes) {
 
   _hrm->verify_optional();
   _verifier->verify_region_sets_optional();
+
+  uncommit_regions_if_necessary();
+}
+
+void G1CollectedHeap::uncommit_regions_if_necessary() {
+  if (_uncommit_thread != NULL && _hrm->has_inactive_regions()) {
+    _uncommit_thread->notify_work();
+  }
+}
+
+uint G1CollectedHeap::uncommit_inactive_regions(uint limit) {
+  return _hrm->uncommit_inactive_regions(limit);
 }
 
 class OldRegionSetChecker : public HeapRegionSetChecker {
@@ -1477,6 +1490,7 @@ public:
 G1CollectedHeap::G1CollectedHeap() :
   CollectedHeap(),
   _young_gen_sampling_thread(NULL),
+  _uncommit_thread(NULL),
   _workers(NULL),
   _card_table(NULL),
   _soft_ref_policy(),
@@ -1516,6 +1530,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _cr(NULL),
   _task_queues(NULL),
   _evacuation_failed(false),
+  _to_space_exhausted(false),
   _evacuation_failed_info_array(NULL),
   _preserved_marks_set(true /* in_c_heap */),
 #ifndef PRODUCT
@@ -1621,6 +1636,15 @@ jint G1CollectedHeap::initialize_young_gen_sampling_thread() {
   return JNI_OK;
 }
 
+jint G1CollectedHeap::initialize_uncommit_thread() {
+  _uncommit_thread = new G1UncommitRegionThread();
+  if (_uncommit_thread->osthread() == NULL) {
+    vm_shutdown_during_initialization("Could not create G1UncommitRegionThread");
+    return JNI_ENOMEM;
+  }
+  return JNI_OK;
+}
+
 jint G1CollectedHeap::initialize() {
 
   // Necessary to satisfy locking discipline assertions.
@@ -1795,6 +1819,13 @@ jint G1CollectedHeap::initialize() {
     return ecode;
   }
 
+  if (G1UseConcurrentUncommit) {
+    ecode = initialize_uncommit_thread();
+    if (ecode != JNI_OK) {
+      return ecode;
+    }
+  }
+
   {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     dcqs.set_process_cards_threshold(concurrent_refine()->yellow_zone());
@@ -1837,6 +1868,9 @@ void G1CollectedHeap::stop() {
   // that are destroyed during shutdown.
   _cr->stop();
   _young_gen_sampling_thread->stop();
+  if (_uncommit_thread != NULL) {
+    _uncommit_thread->stop();
+  }
   _cm_thread->stop();
   if (G1StringDedup::is_enabled()) {
     G1StringDedup::stop();
@@ -2357,6 +2391,30 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+class G1ParallelObjectIterator : public ParallelObjectIterator {
+private:
+  G1CollectedHeap*  _heap;
+  HeapRegionClaimer _claimer;
+
+public:
+  G1ParallelObjectIterator(uint thread_num) :
+      _heap(G1CollectedHeap::heap()),
+      _claimer(thread_num == 0 ? G1CollectedHeap::heap()->workers()->active_workers() : thread_num) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    _heap->object_iterate_parallel(cl, worker_id, &_claimer);
+  }
+};
+
+ParallelObjectIterator* G1CollectedHeap::parallel_object_iterator(uint thread_num) {
+  return new G1ParallelObjectIterator(thread_num);
+}
+
+void G1CollectedHeap::object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer) {
+  IterateObjectClosureRegionClosure blk(cl);
+  heap_region_par_iterate_from_worker_offset(&blk, claimer, worker_id);
+}
+
 void G1CollectedHeap::keep_alive(oop obj) {
   G1BarrierSet::enqueue(obj);
 }
@@ -2441,6 +2499,17 @@ jlong G1CollectedHeap::millis_since_last_gc() {
   return ret_val;
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(!is_gc_active(), "must not be called during GC");
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(!is_gc_active(), "must not be called during GC");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 void G1CollectedHeap::deduplicate_string(oop str) {
   assert(java_lang_String::is_instance(str), "invariant");
 
@@ -2576,6 +2645,9 @@ void G1CollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   _cm->threads_do(tc);
   _cr->threads_do(tc);
   tc->do_thread(_young_gen_sampling_thread);
+  if (_uncommit_thread != NULL) {
+    tc->do_thread(_uncommit_thread);
+  }
   if (G1StringDedup::is_enabled()) {
     G1StringDedup::threads_do(tc);
   }
@@ -3136,8 +3208,10 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
     }
 
     // Print the remainder of the GC log output.
-    if (evacuation_failed()) {
+    if (to_space_exhausted()) {
       log_info(gc)("To-space exhausted");
+    } else if (evacuation_failed()) {
+      log_info(gc)("Evacuation failed for regions with pinned objects");
     }
 
     policy()->print_phases();
@@ -3193,10 +3267,13 @@ void G1CollectedHeap::restore_after_evac_failure(G1RedirtyCardsQueueSet* rdcqs)
   phase_times()->record_evac_fail_remove_self_forwards((os::elapsedTime() - remove_self_forwards_start) * 1000.0);
 }
 
-void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj, markWord m) {
+void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj, markWord m, bool cause_pinned) {
   if (!_evacuation_failed) {
     _evacuation_failed = true;
   }
+  if (!cause_pinned && !_to_space_exhausted) {
+    _to_space_exhausted = true;
+  }
 
   _evacuation_failed_info_array[worker_id].register_copy_failure(obj->size());
   _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
@@ -3632,6 +3709,11 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       if (!region->rem_set()->is_complete()) {
         return false;
       }
+
+      // A pinned object is in use by a JNI critical section.
+      if (region->has_pinned_objects()) {
+        return false;
+      }
       // Candidate selection must satisfy the following constraints
       // while concurrent marking is in progress:
       //
@@ -3687,6 +3769,9 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
     virtual bool do_heap_region(HeapRegion* hr) {
       // First prepare the region for scanning
       _g1h->rem_set()->prepare_region_for_scan(hr);
+      // There are no concurrent remembered set lookups during the pause, so
+      // memory kept alive for them can be freed.
+      hr->rem_set()->free_retired_tables();
 
       // Now check if region is a humongous candidate
       if (!hr->is_starts_humongous()) {
@@ -3753,6 +3838,7 @@ void G1CollectedHeap::pre_evacuate_collection_set(G1EvacuationInfo& evacuation_i
 
   _expand_heap_after_alloc_failure = true;
   _evacuation_failed = false;
+  _to_space_exhausted = false;
 
   // Disable the hot card cache.
   _hot_card_cache->reset_hot_cache_claimed_index();
@@ -80,6 +80,7 @@ class G1CollectionSet;
 class G1Policy;
 class G1HotCardCache;
 class G1RemSet;
+class G1UncommitRegionThread;
 class G1YoungRemSetSamplingThread;
 class G1ConcurrentMark;
 class G1ConcurrentMarkThread;
@@ -155,6 +156,7 @@ class G1CollectedHeap : public CollectedHeap {
 
 private:
   G1YoungRemSetSamplingThread* _young_gen_sampling_thread;
+  G1UncommitRegionThread* _uncommit_thread;
 
   WorkGang* _workers;
   G1CardTable* _card_table;
@@ -735,6 +737,16 @@ private:
   void shrink(size_t expand_bytes);
   void shrink_helper(size_t expand_bytes);
 
+  // Wakes up the G1UncommitRegionThread if shrinking left inactive regions.
+  void uncommit_regions_if_necessary();
+
+public:
+  // Uncommit the memory of up to limit inactive regions. Returns the number
+  // of regions uncommitted. Called by the G1UncommitRegionThread.
+  uint uncommit_inactive_regions(uint limit);
+
+private:
+
   #if TASKQUEUE_STATS
   static void print_taskqueue_stats_hdr(outputStream* const st);
   void print_taskqueue_stats() const;
@@ -819,6 +831,9 @@ public:
 
   // True iff a evacuation has failed in the current collection.
   bool _evacuation_failed;
+  // True iff an evacuation failure in the current collection was caused by
+  // running out of space, not only by regions with pinned objects.
+  bool _to_space_exhausted;
 
   EvacuationFailedInfo* _evacuation_failed_info_array;
 
@@ -833,8 +848,9 @@ public:
   PreservedMarksSet _preserved_marks_set;
 
   // Preserve the mark of "obj", if necessary, in preparation for its mark
-  // word being overwritten with a self-forwarding-pointer.
-  void preserve_mark_during_evac_failure(uint worker_id, oop obj, markWord m);
+  // word being overwritten with a self-forwarding-pointer. cause_pinned
+  // tells whether "obj" failed to move because its region has pinned objects.
+  void preserve_mark_during_evac_failure(uint worker_id, oop obj, markWord m, bool cause_pinned);
 
 #ifndef PRODUCT
   // Support for forcing evacuation failures. Analogous to
@@ -964,6 +980,7 @@ public:
 private:
   jint initialize_concurrent_refinement();
   jint initialize_young_gen_sampling_thread();
+  jint initialize_uncommit_thread();
 public:
   // Initialize the G1CollectedHeap to have the initial and
   // maximum sizes and remembered and barrier sets
@@ -1106,6 +1123,10 @@ public:
   // True iff an evacuation has failed in the most-recent collection.
   bool evacuation_failed() { return _evacuation_failed; }
 
+  // True iff the most-recent collection could not allocate space for all
+  // objects to evacuate.
+  bool to_space_exhausted() { return _to_space_exhausted; }
+
   void remove_from_old_sets(const uint old_regions_removed, const uint humongous_regions_removed);
   void prepend_to_freelist(FreeRegionList* list);
   void decrement_summary_bytes(size_t bytes);
@@ -1171,6 +1192,11 @@ public:
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl);
 
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
+
+  // Iterate over the objects of the regions claimed from claimer by this worker.
+  void object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer);
+
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
   virtual void keep_alive(oop obj);
 
@@ -1380,6 +1406,13 @@ public:
   // No nmethod verification implemented.
   virtual void verify_nmethod(nmethod* nm) {}
 
+  // Objects are pinned by incrementing the pinned object count of their
+  // region. Regions with pinned objects are never evacuated or compacted,
+  // so JNI critical sections do not need to lock out garbage collection.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // Free up superfluous code root memory.
   void purge_code_root_memory();
 
@@ -34,26 +34,84 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
-class G1ResetHumongousClosure : public HeapRegionClosure {
+// Replaces the dead objects in a region that is not compacted with filler
+// objects and rebuilds the BOT of the region along the way.
+class G1FillDeadObjectsClosure : public StackObj {
+  HeapRegion* _hr;
+  HeapWord* _last_live_end;
+
+  void fill_range(HeapWord* start, HeapWord* end) {
+    if (start == end) {
+      return;
+    }
+    CollectedHeap::fill_with_objects(start, pointer_delta(end, start));
+    // fill_with_objects() may have used more than one object.
+    HeapWord* cur = start;
+    while (cur < end) {
+      HeapWord* next = cur + oop(cur)->size();
+      _hr->cross_threshold(cur, next);
+      cur = next;
+    }
+  }
+
+public:
+  G1FillDeadObjectsClosure(HeapRegion* hr) :
+      _hr(hr),
+      _last_live_end(hr->bottom()) { }
+
+  size_t apply(oop obj) {
+    HeapWord* obj_addr = cast_from_oop<HeapWord*>(obj);
+    size_t size = obj->size();
+    fill_range(_last_live_end, obj_addr);
+    _last_live_end = obj_addr + size;
+    _hr->cross_threshold(obj_addr, _last_live_end);
+    return size;
+  }
+
+  void fill_remainder() {
+    fill_range(_last_live_end, _hr->top());
+  }
+};
+
+class G1ResetPinnedClosure : public HeapRegionClosure {
   G1CMBitMap* _bitmap;
 
+  void reset_humongous(HeapRegion* current) {
+    if (current->is_starts_humongous()) {
+      oop obj = oop(current->bottom());
+      if (_bitmap->is_marked(obj)) {
+        // Clear bitmap and fix mark word.
+        _bitmap->clear(obj);
+        obj->init_mark_raw();
+      } else {
+        assert(current->is_empty(), "Should have been cleared in phase 2.");
+      }
+    }
+    current->reset_humongous_during_compaction();
+  }
+
+  // A region with pinned objects keeps its objects in place. Since it may
+  // have been a young region, the BOT is rebuilt while filling the dead
+  // objects so that the region can become an old region.
+  void reset_region_with_pinned_objects(HeapRegion* current) {
+    assert(current->compaction_top() == current->top(), "Region %u should not be compacted", current->hrm_index());
+    current->reset_bot();
+    G1FillDeadObjectsClosure fill(current);
+    current->apply_to_marked_objects(_bitmap, &fill);
+    fill.fill_remainder();
+    _bitmap->clear_region(current);
+    current->complete_compaction();
+  }
+
 public:
-  G1ResetHumongousClosure(G1CMBitMap* bitmap) :
+  G1ResetPinnedClosure(G1CMBitMap* bitmap) :
       _bitmap(bitmap) { }
 
   bool do_heap_region(HeapRegion* current) {
     if (current->is_humongous()) {
-      if (current->is_starts_humongous()) {
-        oop obj = oop(current->bottom());
-        if (_bitmap->is_marked(obj)) {
-          // Clear bitmap and fix mark word.
-          _bitmap->clear(obj);
-          obj->init_mark_raw();
-        } else {
-          assert(current->is_empty(), "Should have been cleared in phase 2.");
-        }
-      }
-      current->reset_humongous_during_compaction();
+      reset_humongous(current);
+    } else if (!current->is_pinned() && current->has_pinned_objects()) {
+      reset_region_with_pinned_objects(current);
     }
     return false;
   }
@@ -96,7 +154,7 @@ void G1FullGCCompactTask::work(uint worker_id) {
     compact_region(*it);
   }
 
-  G1ResetHumongousClosure hc(collector()->mark_bitmap());
+  G1ResetPinnedClosure hc(collector()->mark_bitmap());
   G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&hc, &_claimer, worker_id);
   log_task("Compaction task", worker_id, start);
 }
@@ -50,7 +50,15 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       free_humongous_region(hr);
     }
   } else if (!hr->is_pinned()) {
-    prepare_for_compaction(hr);
+    if (hr->has_pinned_objects()) {
+      // Regions with pinned objects are not compacted. Their live objects
+      // stay in place and the dead ones are filled during compaction.
+      G1PrepareInPlaceLiveClosure prepare_in_place;
+      hr->apply_to_marked_objects(_bitmap, &prepare_in_place);
+      hr->set_compaction_top(hr->top());
+    } else {
+      prepare_for_compaction(hr);
+    }
   }
 
   // Reset data structures not valid after Full GC.
@@ -129,6 +137,18 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
   return size;
 }
 
+size_t G1FullGCPrepareTask::G1PrepareInPlaceLiveClosure::apply(oop object) {
+  // The object does not move, but its mark word may be in use so that it
+  // looks forwarded. The adjust phase would then redirect references to it
+  // to a garbage address. Clear the mark like G1FullGCCompactionPoint::forward()
+  // does for objects compacted in place; it is restored by preserved marks.
+  if (object->forwardee() != NULL) {
+    object->init_mark_raw();
+  }
+  assert(object->forwardee() == NULL, "should be forwarded to NULL");
+  return object->size();
+}
+
 size_t G1FullGCPrepareTask::G1RePrepareClosure::apply(oop obj) {
   // We only re-prepare objects forwarded within the current region, so
   // skip objects that are already forwarded to another region.
@@ -78,6 +78,12 @@ protected:
     size_t apply(oop object);
   };
 
+  // Prepares the live objects of a region that is not compacted.
+  class G1PrepareInPlaceLiveClosure : public StackObj {
+  public:
+    size_t apply(oop object);
+  };
+
   class G1RePrepareClosure : public StackObj {
     G1FullGCCompactionPoint* _cp;
     HeapRegion* _current;
@@ -27,10 +27,17 @@
 #include "gc/g1/heapRegion.hpp"
 #include "g1HeapRegionEventSender.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/vmThread.hpp"
 
 class DumpEventInfoClosure : public HeapRegionClosure {
+  uint _humongous_objects;
+  uint _humongous_regions;
+  size_t _humongous_wasted;
+
 public:
+  DumpEventInfoClosure() : _humongous_objects(0), _humongous_regions(0), _humongous_wasted(0) { }
+
   bool do_heap_region(HeapRegion* r) {
     EventG1HeapRegionInformation evt;
     evt.set_index(r->hrm_index());
@@ -38,14 +45,35 @@ public:
     evt.set_start((uintptr_t)r->bottom());
     evt.set_used(r->used());
     evt.commit();
+
+    if (r->is_humongous()) {
+      _humongous_regions++;
+      if (r->is_starts_humongous()) {
+        _humongous_objects++;
+        // The tail of the last region is filled with dummy objects and can
+        // not be used for other allocations.
+        size_t word_size = oop(r->bottom())->size();
+        size_t num_regions = G1CollectedHeap::humongous_obj_size_in_regions(word_size);
+        _humongous_wasted += num_regions * HeapRegion::GrainBytes - word_size * HeapWordSize;
+      }
+    }
     return false;
   }
+
+  void send_humongous_fragmentation_event() {
+    EventG1HumongousFragmentation evt;
+    evt.set_humongousObjects(_humongous_objects);
+    evt.set_humongousRegions(_humongous_regions);
+    evt.set_wasted(_humongous_wasted);
+    evt.commit();
+  }
 };
 
 class VM_G1SendHeapRegionInfoEvents : public VM_Operation {
   virtual void doit() {
     DumpEventInfoClosure c;
     G1CollectedHeap::heap()->heap_region_iterate(&c);
+    c.send_humongous_fragmentation_event();
   }
   virtual VMOp_Type type() const { return VMOp_HeapIterateOperation; }
 };
@@ -31,17 +31,21 @@
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1Trace.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 
 G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
                                            G1RedirtyCardsQueueSet* rdcqs,
                                            uint worker_id,
                                            size_t young_cset_length,
-                                           size_t optional_cset_length)
+                                           size_t optional_cset_length,
+                                           uint* worker_node_index,
+                                           uint num_workers)
   : _g1h(g1h),
     _task_queue(g1h->task_queue(worker_id)),
     _rdcq(rdcqs),
@@ -62,7 +66,12 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _old_gen_is_full(false),
     _num_optional_regions(optional_cset_length),
     _numa(g1h->numa()),
-    _obj_alloc_stat(NULL)
+    _obj_alloc_stat(NULL),
+    _worker_node_index(worker_node_index),
+    _num_workers(num_workers),
+    _node_index(G1NUMA::UnknownNodeIndex),
+    _last_same_node_victim(worker_id),
+    _next_same_node_candidate((worker_id + 1) % num_workers)
 {
   // We allocate number of young gen regions in the collection set plus one
   // entries, since entry 0 keeps track of surviving bytes for non-young regions.
@@ -85,6 +94,14 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
   _oops_into_optional_regions = new G1OopStarChunkedList[_num_optional_regions];
 
   initialize_numa_stats();
+
+  if (_worker_node_index != NULL) {
+    // States are usually created lazily by the worker itself, so this is
+    // the node the worker is running on. Threads may migrate, so this is
+    // only a hint.
+    _node_index = _numa->index_of_current_thread();
+    Atomic::store(&_worker_node_index[worker_id], _node_index);
+  }
 }
 
 size_t G1ParScanThreadState::flush(size_t* surviving_young_words) {
@@ -230,6 +247,13 @@ oop G1ParScanThreadState::copy_to_survivor_space(G1HeapRegionAttr const region_a
                                                  markWord const old_mark) {
   const size_t word_sz = old->size();
 
+  HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  // Objects in regions with pinned objects stay in place; the region is
+  // retained as an old region like one that failed evacuation.
+  if (from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark, true /* cause_pinned */);
+  }
+
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   // The second clause is to prevent premature evacuation failure in case there
@@ -237,7 +261,6 @@ oop G1ParScanThreadState::copy_to_survivor_space(G1HeapRegionAttr const region_a
   if (_old_gen_is_full && dest_attr.is_old()) {
     return handle_evacuation_failure_par(old, old_mark);
   }
-  HeapRegion* const from_region = _g1h->heap_region_containing(old);
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -341,11 +364,43 @@ oop G1ParScanThreadState::copy_to_survivor_space(G1HeapRegionAttr const region_a
   }
 }
 
+bool G1ParScanThreadState::try_steal_from(G1ScannerTasksQueueSet* task_queues, uint victim, ScannerTask& t) {
+  return victim != _worker_id &&
+         Atomic::load(&_worker_node_index[victim]) == _node_index &&
+         task_queues->queue(victim)->pop_global(t);
+}
+
+bool G1ParScanThreadState::steal_from_same_node(G1ScannerTasksQueueSet* task_queues, ScannerTask& t) {
+  if (_worker_node_index == NULL || _node_index == G1NUMA::UnknownNodeIndex) {
+    return false;
+  }
+  // Start with the worker we last stole from; it is likely to still have work.
+  if (try_steal_from(task_queues, _last_same_node_victim, t)) {
+    return true;
+  }
+  // Only probe a few other workers per attempt. This is called for every
+  // steal attempt, including the ones spinning during termination, so it
+  // must not scan all workers. The cursor moves on between attempts, so
+  // all workers are still visited over successive attempts.
+  for (uint i = 0; i < SameNodeStealCandidates; i++) {
+    uint victim = _next_same_node_candidate;
+    if (++_next_same_node_candidate == _num_workers) {
+      _next_same_node_candidate = 0;
+    }
+    if (victim != _last_same_node_victim && try_steal_from(task_queues, victim, t)) {
+      _last_same_node_victim = victim;
+      return true;
+    }
+  }
+  return false;
+}
+
 G1ParScanThreadState* G1ParScanThreadStateSet::state_for_worker(uint worker_id) {
   assert(worker_id < _n_workers, "out of bounds access");
   if (_states[worker_id] == NULL) {
     _states[worker_id] =
-      new G1ParScanThreadState(_g1h, _rdcqs, worker_id, _young_cset_length, _optional_cset_length);
+      new G1ParScanThreadState(_g1h, _rdcqs, worker_id, _young_cset_length, _optional_cset_length,
+                               _worker_node_index, _n_workers);
   }
   return _states[worker_id];
 }
@@ -396,7 +451,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
   }
 }
 
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, bool cause_pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -409,7 +464,7 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
      _g1h->hr_printer()->evac_failure(r);
     }
 
-    _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
+    _g1h->preserve_mark_during_evac_failure(_worker_id, old, m, cause_pinned);
 
     G1ScanInYoungSetter x(&_scanner, r->is_young());
     old->oop_iterate_backwards(&_scanner);
@@ -438,15 +493,24 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
     _young_cset_length(young_cset_length),
     _optional_cset_length(optional_cset_length),
     _n_workers(n_workers),
+    _worker_node_index(NULL),
     _flushed(false) {
   for (uint i = 0; i < n_workers; ++i) {
     _states[i] = NULL;
   }
   memset(_surviving_young_words_total, 0, (young_cset_length + 1) * sizeof(size_t));
+
+  if (g1h->numa()->is_enabled()) {
+    _worker_node_index = NEW_C_HEAP_ARRAY(uint, n_workers, mtGC);
+    for (uint i = 0; i < n_workers; ++i) {
+      _worker_node_index[i] = G1NUMA::UnknownNodeIndex;
+    }
+  }
 }
 
 G1ParScanThreadStateSet::~G1ParScanThreadStateSet() {
   assert(_flushed, "thread local state from the per thread states should have been flushed");
   FREE_C_HEAP_ARRAY(G1ParScanThreadState*, _states);
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_total);
+  FREE_C_HEAP_ARRAY(uint, _worker_node_index);
 }
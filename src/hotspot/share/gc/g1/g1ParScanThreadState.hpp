@@ -104,12 +104,31 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // transferred when flushed.
   size_t* _obj_alloc_stat;
 
+  // The memory node of every worker, shared between all G1ParScanThreadStates
+  // of a G1ParScanThreadStateSet. Used to prefer stealing from queues of
+  // workers running on the same node. NULL if NUMA is not enabled.
+  uint* _worker_node_index;
+  uint _num_workers;
+  // The memory node this worker was running on when this state was created.
+  uint _node_index;
+  // The worker we last successfully stole from on the same node.
+  uint _last_same_node_victim;
+  // The next worker to probe when the last victim has no work.
+  uint _next_same_node_candidate;
+
+  // Number of workers, besides the last victim, probed per steal attempt.
+  static const uint SameNodeStealCandidates = 2;
+
+  bool try_steal_from(G1ScannerTasksQueueSet* task_queues, uint victim, ScannerTask& t);
+
 public:
   G1ParScanThreadState(G1CollectedHeap* g1h,
                        G1RedirtyCardsQueueSet* rdcqs,
                        uint worker_id,
                        size_t young_cset_length,
-                       size_t optional_cset_length);
+                       size_t optional_cset_length,
+                       uint* worker_node_index,
+                       uint num_workers);
   virtual ~G1ParScanThreadState();
 
   void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
@@ -203,9 +222,12 @@ public:
   void reset_trim_ticks();
 
   inline void steal_and_trim_queue(G1ScannerTasksQueueSet *task_queues);
+  // Try to steal a task from a worker on the same memory node.
+  bool steal_from_same_node(G1ScannerTasksQueueSet* task_queues, ScannerTask& t);
 
   // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markWord m);
+  // cause_pinned is true if the region of "obj" contains pinned objects.
+  oop handle_evacuation_failure_par(oop obj, markWord m, bool cause_pinned = false);
 
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
@@ -223,6 +245,8 @@ class G1ParScanThreadStateSet : public StackObj {
   size_t _young_cset_length;
   size_t _optional_cset_length;
   uint _n_workers;
+  // Memory node of each worker, see G1ParScanThreadState::_worker_node_index.
+  uint* _worker_node_index;
   bool _flushed;
 
  public:
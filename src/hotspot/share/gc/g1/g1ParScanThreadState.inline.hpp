@@ -138,7 +138,10 @@ inline void G1ParScanThreadState::dispatch_task(ScannerTask task) {
 
 void G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet *task_queues) {
   ScannerTask stolen_task;
-  while (task_queues->steal(_worker_id, stolen_task)) {
+  // Prefer work from workers on the same memory node, whose objects are more
+  // likely to be node-local, before stealing from random queues.
+  while (steal_from_same_node(task_queues, stolen_task) ||
+         task_queues->steal(_worker_id, stolen_task)) {
     dispatch_task(stolen_task);
 
     // We've just processed a task and we might have made
@@ -73,6 +73,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _rs_length(0),
   _rs_length_prediction(0),
   _pending_cards_at_gc_start(0),
+  _predicted_pause_time_ms(0.0),
   _old_gen_alloc_tracker(),
   _initial_mark_to_mixed(),
   _collection_set(NULL),
@@ -534,6 +535,7 @@ void G1Policy::record_collection_pause_start(double start_time_sec) {
   record_concurrent_refinement_stats();
 
   _collection_set->reset_bytes_used_before();
+  _predicted_pause_time_ms = 0.0;
 
   // do that for any other surv rate groups
   _eden_surv_rate_group->stop_adding_regions();
@@ -637,6 +639,9 @@ void G1Policy::record_collection_pause_end(double pause_time_ms) {
 
   bool update_stats = !_g1h->evacuation_failed();
 
+  log_debug(gc, ergo)("Pause time prediction: predicted %1.2fms, actual %1.2fms, error %1.2fms",
+                      _predicted_pause_time_ms, pause_time_ms, pause_time_ms - _predicted_pause_time_ms);
+
   record_pause(young_gc_pause_kind(), end_time_sec - pause_time_ms / 1000.0, end_time_sec);
 
   _collection_pause_end_millis = os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
@@ -1349,6 +1354,8 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
     log_debug(gc, ergo, cset)("Old candidate collection set empty.");
   }
 
+  add_predicted_pause_time_ms(predicted_old_time_ms);
+
   if (num_expensive_regions > 0) {
     log_debug(gc, ergo, cset)("Added %u initial old regions to collection set although the predicted time was too high.",
                               num_expensive_regions);
@@ -1373,7 +1380,8 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidat
   HeapRegion* r = candidates->at(candidate_idx);
   while (num_optional_regions < max_optional_regions) {
     assert(r != NULL, "Region must exist");
-    prediction_ms += predict_region_total_time_ms(r, false);
+    double region_prediction_ms = predict_region_total_time_ms(r, false);
+    prediction_ms += region_prediction_ms;
 
     if (prediction_ms > time_remaining_ms) {
       log_debug(gc, ergo, cset)("Prediction %.3fms for region %u does not fit remaining time: %.3fms.",
@@ -1381,6 +1389,7 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidat
       break;
     }
     // This region will be included in the next optional evacuation.
+    add_predicted_pause_time_ms(region_prediction_ms);
 
     time_remaining_ms -= prediction_ms;
     num_optional_regions++;
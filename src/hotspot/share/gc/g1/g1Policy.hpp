@@ -103,6 +103,11 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Sum of the time predictions for the parts of the collection set that
+  // were selected for the current pause. Compared with the actual pause
+  // time at the end of the pause.
+  double _predicted_pause_time_ms;
+
   // Tracking the allocation in the old generation between
   // two GCs.
   G1OldGenAllocationTracker _old_gen_alloc_tracker;
@@ -245,6 +250,8 @@ private:
 public:
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  void add_predicted_pause_time_ms(double time_ms) { _predicted_pause_time_ms += time_ms; }
+
   // Calculate the minimum number of old regions we'll add to the CSet
   // during a mixed GC.
   uint calc_min_old_cset_length() const;
@@ -212,6 +212,10 @@ void G1RegionToSpaceMapper::fire_on_commit(uint start_idx, size_t num_regions, b
   }
 }
 
+void G1RegionToSpaceMapper::signal_mapping_changed(uint start_idx, size_t num_regions) {
+  fire_on_commit(start_idx, num_regions, false);
+}
+
 static bool map_nvdimm_space(ReservedSpace rs) {
   assert(AllocateOldGenAt != NULL, "");
   int _backing_fd = os::create_file_for_heap(AllocateOldGenAt);
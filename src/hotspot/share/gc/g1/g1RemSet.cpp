@@ -53,6 +53,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/stack.inline.hpp"
 #include "utilities/ticks.hpp"
@@ -514,15 +516,31 @@ private:
     return (value & ToScanMask) == 0;
   }
 
-  bool cur_word_of_cards_contains_any_dirty_card() const {
+  // Returns a word with the to-scan bit set for every dirty card in the
+  // current word of cards.
+  size_t cur_word_dirty_cards() const {
     assert(cur_addr_aligned(), "Current address should be aligned");
     size_t const value = *(size_t*)_cur_addr;
-    return (~value & ExpandedToScanMask) != 0;
+    return ~value & ExpandedToScanMask;
   }
 
-  bool cur_word_of_cards_all_dirty_cards() const {
+  // Returns a word with the to-scan bit set for every non-dirty card in the
+  // current word of cards.
+  size_t cur_word_non_dirty_cards() const {
+    assert(cur_addr_aligned(), "Current address should be aligned");
     size_t const value = *(size_t*)_cur_addr;
-    return value == G1CardTable::WordAllDirty;
+    return value & ExpandedToScanMask;
+  }
+
+  // Returns the index of the first card within a word of cards that has its
+  // to-scan bit set in the given mask, avoiding a card-by-card search.
+  static size_t first_card_in_word(size_t mask) {
+    assert(mask != 0, "Must have at least one card selected");
+#ifdef VM_LITTLE_ENDIAN
+    return count_trailing_zeros(mask) / BitsPerByte;
+#else
+    return count_leading_zeros(mask) / BitsPerByte;
+#endif
   }
 
   size_t get_and_advance_pos() {
@@ -550,14 +568,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (cur_word_of_cards_contains_any_dirty_card()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a dirty card in the word.");
+      size_t const dirty = cur_word_dirty_cards();
+      if (dirty != 0) {
+        _cur_addr += first_card_in_word(dirty);
+        assert(cur_card_is_dirty(), "Should have found a dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -576,14 +591,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (!cur_word_of_cards_all_dirty_cards()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (!cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a non-dirty card in the word.");
+      size_t const non_dirty = cur_word_non_dirty_cards();
+      if (non_dirty != 0) {
+        _cur_addr += first_card_in_word(non_dirty);
+        assert(!cur_card_is_dirty(), "Should have found a non-dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
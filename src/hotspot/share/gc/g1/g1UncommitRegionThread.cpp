@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1UncommitRegionThread.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/ticks.hpp"
+
+G1UncommitRegionThread::G1UncommitRegionThread() :
+    ConcurrentGCThread(),
+    _monitor(Mutex::nonleaf,
+             "G1UncommitRegionThread monitor",
+             true,
+             Monitor::_safepoint_check_never),
+    _has_work(false) {
+  set_name("G1 Uncommit");
+  create_and_start();
+}
+
+void G1UncommitRegionThread::notify_work() {
+  MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  _has_work = true;
+  ml.notify();
+}
+
+bool G1UncommitRegionThread::wait_for_work() {
+  MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  while (!_has_work && !should_terminate()) {
+    ml.wait();
+  }
+  _has_work = false;
+  return !should_terminate();
+}
+
+void G1UncommitRegionThread::uncommit_inactive_regions() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  const uint limit = MAX2((uint)(UncommitSizeLimit / HeapRegion::GrainBytes), 1u);
+
+  Ticks start = Ticks::now();
+  uint uncommitted = 0;
+  while (!should_terminate()) {
+    uint num_regions;
+    {
+      // Safepoints may only occur between chunks.
+      SuspendibleThreadSetJoiner sts;
+      num_regions = g1h->uncommit_inactive_regions(limit);
+    }
+    if (num_regions == 0) {
+      break;
+    }
+    uncommitted += num_regions;
+  }
+
+  if (uncommitted > 0) {
+    size_t uncommitted_bytes = uncommitted * HeapRegion::GrainBytes;
+    log_debug(gc, heap)("Concurrent uncommit: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                        byte_size_in_proper_unit(uncommitted_bytes),
+                        proper_unit_for_byte_size(uncommitted_bytes),
+                        uncommitted,
+                        (Ticks::now() - start).seconds() * MILLIUNITS);
+  }
+}
+
+void G1UncommitRegionThread::run_service() {
+  while (wait_for_work()) {
+    uncommit_inactive_regions();
+  }
+}
+
+void G1UncommitRegionThread::stop_service() {
+  MutexLocker x(&_monitor, Mutex::_no_safepoint_check_flag);
+  _monitor.notify();
+}
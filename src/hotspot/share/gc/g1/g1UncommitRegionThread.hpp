@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_GC_G1_G1UNCOMMITREGIONTHREAD_HPP
+#define SHARE_GC_G1_G1UNCOMMITREGIONTHREAD_HPP
+
+#include "gc/shared/concurrentGCThread.hpp"
+#include "runtime/mutex.hpp"
+
+// The G1UncommitRegionThread uncommits the memory of regions that have been
+// removed from the heap.
+//
+// Shrinking the heap during a Remark or Full GC pause only deactivates the
+// regions to remove, i.e. takes them out of the heap. The actual uncommit,
+// which may take considerable time, is done concurrently by this thread.
+// The memory is uncommitted in chunks, each within the suspendible thread
+// set, so that safepoints are only delayed by the uncommit of a single chunk.
+// Inactive regions that are needed again before they are uncommitted are
+// simply reactivated.
+class G1UncommitRegionThread: public ConcurrentGCThread {
+private:
+  // The maximum amount of memory uncommitted without allowing a safepoint.
+  static const size_t UncommitSizeLimit = 128 * M;
+
+  Monitor _monitor;
+  bool _has_work;
+
+  void run_service();
+  void stop_service();
+
+  // Waits until there are inactive regions to uncommit. Returns false if
+  // the thread should terminate instead.
+  bool wait_for_work();
+  void uncommit_inactive_regions();
+
+public:
+  G1UncommitRegionThread();
+
+  // Wakes up the thread to uncommit the memory of inactive regions.
+  void notify_work();
+};
+
+#endif // SHARE_GC_G1_G1UNCOMMITREGIONTHREAD_HPP
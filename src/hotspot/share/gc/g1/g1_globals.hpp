@@ -310,6 +310,11 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  experimental(bool, G1UseConcurrentUncommit, true,                         \
+               "Uncommit the memory of regions removed from the heap "      \
+               "concurrently instead of during the pause that shrinks "     \
+               "the heap.")                                                 \
+                                                                            \
   experimental(uintx, G1YoungExpansionBufferPercent, 10,                    \
                "When heterogenous heap is enabled by AllocateOldGenAt "     \
                "option, after every GC, young gen is re-sized which "       \
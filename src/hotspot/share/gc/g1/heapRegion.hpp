@@ -210,6 +210,10 @@ private:
   // True iff an attempt to evacuate an object in the region failed.
   bool _evacuation_failed;
 
+  // Number of objects in this region currently pinned by JNI critical
+  // sections. Objects in a region with pinned objects are never moved.
+  volatile size_t _pinned_object_count;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -414,6 +418,14 @@ public:
   bool is_open_archive()   const { return _type.is_open_archive(); }
   bool is_closed_archive() const { return _type.is_closed_archive(); }
 
+  // Pinning objects through JNI critical sections keeps the whole region
+  // from being evacuated or compacted. These may be called concurrently by
+  // multiple threads outside of a safepoint.
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+  inline size_t pinned_count() const;
+  inline bool has_pinned_objects() const;
+
   void set_free();
 
   void set_eden();
@@ -418,4 +418,21 @@ inline void HeapRegion::record_surv_words_in_group(size_t words_survived) {
   _surv_rate_group->record_surviving_words(age_in_group, words_survived);
 }
 
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(pinned_count() > 0, "Unbalanced unpin of objects in region %u", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
@@ -35,6 +35,7 @@
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -69,6 +70,8 @@ HeapRegionManager::HeapRegionManager() :
   _cardtable_mapper(NULL),
   _card_counts_mapper(NULL),
   _available_map(mtGC),
+  _inactive_map(mtGC),
+  _num_inactive(0),
   _num_committed(0),
   _allocated_heapregions_length(0),
   _regions(), _heap_mapper(NULL),
@@ -106,6 +109,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(reserved.start(), reserved.end(), HeapRegion::GrainBytes);
 
   _available_map.initialize(_regions.length());
+  _inactive_map.initialize(_regions.length());
 }
 
 bool HeapRegionManager::is_available(uint region) const {
@@ -221,6 +225,79 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _num_committed -= (uint)num_regions;
 
   _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+
+  // Synchronize with concurrent uncommit of inactive regions sharing pages
+  // of the auxiliary data structures.
+  MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+  uncommit_memory(start, num_regions);
+}
+
+void HeapRegionManager::deactivate_regions(uint start, size_t num_regions) {
+  guarantee(num_regions >= 1, "Need to specify at least one region to deactivate, tried to deactivate zero regions at %u", start);
+  guarantee(_num_committed >= num_regions, "pre-condition");
+  assert_at_safepoint();
+
+  // Reset node index to distinguish with committed regions.
+  for (uint i = start; i < start + num_regions; i++) {
+    at(i)->set_node_index(G1NUMA::UnknownNodeIndex);
+  }
+
+  _num_committed -= (uint)num_regions;
+
+  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+
+  MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+  _inactive_map.set_range(start, start + num_regions);
+  _num_inactive += (uint)num_regions;
+}
+
+void HeapRegionManager::reactivate_regions(uint start, size_t num_regions) {
+  assert(Uncommit_lock->owned_by_self(), "must hold the uncommit lock");
+  assert(_inactive_map.get_next_zero_offset(start, start + num_regions) == start + num_regions,
+         "Should only be inactive regions in the range [%u, " SIZE_FORMAT ")", start, start + num_regions);
+  guarantee(_num_committed + num_regions <= max_length(), "Cannot commit more than the maximum amount of regions");
+
+  _inactive_map.clear_range(start, start + num_regions);
+  _num_inactive -= (uint)num_regions;
+  _num_committed += (uint)num_regions;
+
+  // The memory is still committed, but its contents are stale.
+  clear_auxiliary_data_structures(start, num_regions);
+}
+
+void HeapRegionManager::commit_or_reactivate_regions(uint start, size_t num_regions, WorkGang* pretouch_gang) {
+  // Synchronize with concurrent uncommit of inactive regions.
+  MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  const BitMap::idx_t end = start + num_regions;
+  BitMap::idx_t cur = start;
+  while (cur < end) {
+    BitMap::idx_t next;
+    if (_inactive_map.at(cur)) {
+      next = _inactive_map.get_next_zero_offset(cur, end);
+      reactivate_regions((uint)cur, next - cur);
+    } else {
+      next = _inactive_map.get_next_one_offset(cur, end);
+      commit_regions((uint)cur, next - cur, pretouch_gang);
+    }
+    cur = next;
+  }
+}
+
+void HeapRegionManager::clear_auxiliary_data_structures(uint start, size_t num_regions) {
+  // Signal the listeners as if the memory was committed anew, so that the
+  // from card cache, marking bitmaps, card table and card counts get cleared.
+  _heap_mapper->signal_mapping_changed(start, num_regions);
+  _prev_bitmap_mapper->signal_mapping_changed(start, num_regions);
+  _next_bitmap_mapper->signal_mapping_changed(start, num_regions);
+
+  _bot_mapper->signal_mapping_changed(start, num_regions);
+  _cardtable_mapper->signal_mapping_changed(start, num_regions);
+
+  _card_counts_mapper->signal_mapping_changed(start, num_regions);
+}
+
+void HeapRegionManager::uncommit_memory(uint start, size_t num_regions) {
   _heap_mapper->uncommit_regions(start, num_regions);
 
   // Also uncommit auxiliary data
@@ -235,7 +312,7 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
 
 void HeapRegionManager::make_regions_available(uint start, uint num_regions, WorkGang* pretouch_gang) {
   guarantee(num_regions > 0, "No point in calling this for zero regions");
-  commit_regions(start, num_regions, pretouch_gang);
+  commit_or_reactivate_regions(start, num_regions, pretouch_gang);
   for (uint i = start; i < start + num_regions; i++) {
     if (_regions.get_by_index(i) == NULL) {
       HeapRegion* new_hr = new_heap_region(i);
@@ -557,7 +634,11 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
       (num_last_found = find_empty_from_idx_reverse(cur, &idx_last_found)) > 0) {
     uint to_remove = MIN2(num_regions_to_remove - removed, num_last_found);
 
-    shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
+    if (G1UseConcurrentUncommit) {
+      deactivate_regions(idx_last_found + num_last_found - to_remove, to_remove);
+    } else {
+      shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
+    }
 
     cur = idx_last_found;
     removed += to_remove;
@@ -579,6 +660,42 @@ void HeapRegionManager::shrink_at(uint index, size_t num_regions) {
   uncommit_regions(index, num_regions);
 }
 
+bool HeapRegionManager::has_inactive_regions() const {
+  return Atomic::load(&_num_inactive) > 0;
+}
+
+uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
+  assert(limit > 0, "Need to specify at least one region to uncommit");
+  MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  uint uncommitted = 0;
+  BitMap::idx_t offset = 0;
+  while (uncommitted < limit) {
+    BitMap::idx_t start = _inactive_map.get_next_one_offset(offset);
+    if (start == _inactive_map.size()) {
+      // No more inactive regions.
+      break;
+    }
+    BitMap::idx_t end = _inactive_map.get_next_zero_offset(start);
+    uint num_regions = MIN2((uint)(end - start), limit - uncommitted);
+
+    // Print before uncommitting.
+    if (G1CollectedHeap::heap()->hr_printer()->is_active()) {
+      for (uint i = (uint)start; i < start + num_regions; i++) {
+        G1CollectedHeap::heap()->hr_printer()->uncommit(at(i));
+      }
+    }
+
+    uncommit_memory((uint)start, num_regions);
+    _inactive_map.clear_range(start, start + num_regions);
+    _num_inactive -= num_regions;
+
+    uncommitted += num_regions;
+    offset = start + num_regions;
+  }
+  return uncommitted;
+}
+
 uint HeapRegionManager::find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const {
   guarantee(start_idx < _allocated_heapregions_length, "checking");
   guarantee(res_idx != NULL, "checking");
@@ -624,6 +741,7 @@ void HeapRegionManager::verify() {
       prev_committed = false;
       continue;
     }
+    guarantee(!_inactive_map.at(i), "invariant: available region %u must not be inactive", i);
     num_committed++;
     HeapRegion* hr = _regions.get_by_index(i);
     guarantee(hr != NULL, "invariant: i: %u", i);
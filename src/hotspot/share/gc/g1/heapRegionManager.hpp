@@ -94,6 +94,15 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // for allocation.
   CHeapBitMap _available_map;
 
+  // Each bit in this bitmap indicates that the corresponding region is inactive,
+  // i.e. it has been removed from the heap but its memory is still committed
+  // until the G1UncommitRegionThread gets to uncommit it. Inactive regions are
+  // not available and not included in _num_committed. Protected by Uncommit_lock.
+  CHeapBitMap _inactive_map;
+
+  // The number of inactive regions.
+  volatile uint _num_inactive;
+
    // The number of regions committed in the heap.
   uint _num_committed;
 
@@ -106,6 +115,22 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Pass down commit calls to the VirtualSpace.
   void commit_regions(uint index, size_t num_regions = 1, WorkGang* pretouch_gang = NULL);
 
+  // Commits the given regions, reusing the memory of those that are inactive.
+  void commit_or_reactivate_regions(uint index, size_t num_regions, WorkGang* pretouch_gang);
+
+  // Makes the given inactive regions committed again without touching their memory.
+  void reactivate_regions(uint index, size_t num_regions);
+
+  // Removes the given regions from the heap, leaving the uncommit of their memory
+  // to the G1UncommitRegionThread.
+  void deactivate_regions(uint index, size_t num_regions);
+
+  // Pass down uncommit calls to the VirtualSpace.
+  void uncommit_memory(uint index, size_t num_regions);
+
+  // Resets the auxiliary data of regions whose memory is reused.
+  void clear_auxiliary_data_structures(uint index, size_t num_regions);
+
   // Notify other data structures about change in the heap layout.
   void update_committed_space(HeapWord* old_end, HeapWord* new_end);
 
@@ -289,9 +314,18 @@ public:
   void par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const;
 
   // Uncommit up to num_regions_to_remove regions that are completely free.
-  // Return the actual number of uncommitted regions.
+  // Return the actual number of uncommitted regions. With G1UseConcurrentUncommit
+  // the regions are only deactivated; the memory is uncommitted later by
+  // uncommit_inactive_regions().
   virtual uint shrink_by(uint num_regions_to_remove);
 
+  // Returns whether there are inactive regions whose memory is still committed.
+  bool has_inactive_regions() const;
+
+  // Uncommit the memory of up to limit inactive regions. Returns the number of
+  // regions uncommitted; zero if no inactive regions are left.
+  uint uncommit_inactive_regions(uint limit);
+
   // Uncommit a number of regions starting at the specified index, which must be available,
   // empty, and free.
   void shrink_at(uint index, size_t num_regions);
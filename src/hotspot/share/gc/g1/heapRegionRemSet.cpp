@@ -33,6 +33,7 @@
 #include "memory/padded.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -142,13 +143,17 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
   size_t ind = from_hrm_ind & _mod_max_fine_entries_mask;
   PerRegionTable* prt = find_region_table(ind, from_hr);
   if (prt == NULL) {
+    CardIdx_t card_index = card_within_region(from, from_hr);
+    // Many threads often try to add the same cards; filter those without
+    // taking the lock.
+    if (_sparse_table.contains_card_concurrent(from_hrm_ind, card_index)) {
+      return;
+    }
+
     MutexLocker x(_m, Mutex::_no_safepoint_check_flag);
     // Confirm that it's really not there...
     prt = find_region_table(ind, from_hr);
     if (prt == NULL) {
-
-      CardIdx_t card_index = card_within_region(from, from_hr);
-
       SparsePRT::AddCardResult result = _sparse_table.add_card(from_hrm_ind, card_index);
       if (result != SparsePRT::overflow) {
         if (result == SparsePRT::added) {
@@ -340,6 +345,10 @@ void OtherRegionsTable::clear() {
   _num_occupied = 0;
 }
 
+void OtherRegionsTable::free_retired_tables() {
+  _sparse_table.free_retired_tables();
+}
+
 bool OtherRegionsTable::contains_reference(OopOrNarrowOopStar from) const {
   // Cast away const in this case.
   MutexLocker x((Mutex*)_m, Mutex::_no_safepoint_check_flag);
@@ -403,6 +412,11 @@ void HeapRegionRemSet::clear(bool only_cardset) {
   clear_locked(only_cardset);
 }
 
+void HeapRegionRemSet::free_retired_tables() {
+  assert_at_safepoint();
+  _other_regions.free_retired_tables();
+}
+
 void HeapRegionRemSet::clear_locked(bool only_cardset) {
   if (!only_cardset) {
     _code_roots.clear();
@@ -66,6 +66,11 @@ class nmethod;
 //      it's _coarse_map bit is set, so the that we were attempting to add
 //      is represented.  If a deleted PRT is re-used, a thread adding a bit,
 //      thinking the PRT is for a different region, does no harm.
+//
+// Similarly, threads check whether a card is already in the sparse table
+// without locking. Sparse entries are never reused for a different region
+// before the table is cleared, and a deleted entry has had its cards
+// transferred to a PRT first, so a card found this way is represented.
 
 class OtherRegionsTable {
   G1CollectedHeap* _g1h;
@@ -154,6 +159,9 @@ public:
   // Clear the entire contents of this remembered set.
   void clear();
 
+  // Free memory kept for concurrent readers. Must be called at a safepoint.
+  void free_retired_tables();
+
   // Safe for use by concurrent readers outside _m
   bool is_region_coarsened(RegionIdx_t from_hrm_ind) const;
 };
@@ -381,6 +389,10 @@ public:
   void clear(bool only_cardset = false);
   void clear_locked(bool only_cardset = false);
 
+  // Free memory that has only been kept for concurrent lookups into the
+  // remembered set. Must be called at a safepoint.
+  void free_retired_tables();
+
   // The actual # of bytes this hr_remset takes up.
   // Note also includes the strong code root set.
   size_t mem_size() {
@@ -30,6 +30,7 @@
 #include "gc/shared/cardTableBarrierSet.hpp"
 #include "gc/shared/space.inline.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
 
 // Check that the size of the SparsePRTEntry is evenly divisible by the maximum
 // member type to avoid SIGBUS when accessing them.
@@ -55,6 +56,18 @@ bool SparsePRTEntry::contains_card(CardIdx_t card_index) const {
   return false;
 }
 
+bool SparsePRTEntry::contains_card_concurrent(CardIdx_t card_index) const {
+  // Pairs with the release_store in add_card(): all cards below the
+  // loaded _next_null have been written.
+  int num_cards = Atomic::load_acquire(&_next_null);
+  for (int i = 0; i < num_cards; i++) {
+    if (card(i) == card_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
 SparsePRT::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
   for (int i = 0; i < num_valid_cards(); i++) {
     if (card(i) == card_index) {
@@ -63,9 +76,9 @@ SparsePRT::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
   }
   if (num_valid_cards() < cards_num() - 1) {
     _cards[_next_null] = (card_elem_t)card_index;
-    _next_null++;
+    Atomic::release_store(&_next_null, _next_null + 1);
     return SparsePRT::added;
-   }
+  }
   // Otherwise, we're full.
   return SparsePRT::overflow;
 }
@@ -98,7 +111,7 @@ RSHashTable::RSHashTable() :
   _entries(NULL),
   _buckets(empty_buckets),
   _free_region(0),
-  _free_list(NullEntry) { }
+  _retired_next(NULL) { }
 
 RSHashTable::RSHashTable(size_t capacity) :
   _num_entries((capacity * TableOccupancyFactor) + 1),
@@ -108,7 +121,7 @@ RSHashTable::RSHashTable(size_t capacity) :
   _entries((SparsePRTEntry*)NEW_C_HEAP_ARRAY(char, _num_entries * SparsePRTEntry::size(), mtGC)),
   _buckets(NEW_C_HEAP_ARRAY(int, capacity, mtGC)),
   _free_region(0),
-  _free_list(NullEntry)
+  _retired_next(NULL)
 {
   clear();
 }
@@ -134,7 +147,6 @@ void RSHashTable::clear() {
   // This will put -1 == NullEntry in the key field of all entries.
   memset((void*)_entries, NullEntry, _num_entries * SparsePRTEntry::size());
   memset((void*)_buckets, NullEntry, _capacity * sizeof(int));
-  _free_list = NullEntry;
   _free_region = 0;
 }
 
@@ -148,6 +160,20 @@ SparsePRT::AddCardResult RSHashTable::add_card(RegionIdx_t region_ind, CardIdx_t
   return res;
 }
 
+SparsePRTEntry* RSHashTable::get_entry_concurrent(RegionIdx_t region_ind) const {
+  int ind = (int) (region_ind & capacity_mask());
+  // Pairs with the release_store in entry_for_region_ind_create().
+  int cur_ind = Atomic::load_acquire(&_buckets[ind]);
+  while (cur_ind != NullEntry) {
+    SparsePRTEntry* cur = entry(cur_ind);
+    if (cur->r_ind() == region_ind) {
+      return cur;
+    }
+    cur_ind = Atomic::load(cur->next_index_addr());
+  }
+  return NULL;
+}
+
 SparsePRTEntry* RSHashTable::get_entry(RegionIdx_t region_ind) const {
   int ind = (int) (region_ind & capacity_mask());
   int cur_ind = _buckets[ind];
@@ -176,9 +202,9 @@ bool RSHashTable::delete_entry(RegionIdx_t region_ind) {
   }
 
   if (cur_ind == NullEntry) return false;
-  // Otherwise, splice out "cur".
-  *prev_loc = cur->next_index();
-  free_entry(cur_ind);
+  // Otherwise, splice out "cur". The entry is not reused until the next
+  // clear(), so concurrent readers that still reach it see valid contents.
+  Atomic::store(prev_loc, cur->next_index());
   _occupied_entries--;
   return true;
 }
@@ -190,33 +216,21 @@ RSHashTable::entry_for_region_ind_create(RegionIdx_t region_ind) {
     int new_ind = alloc_entry();
     res = entry(new_ind);
     res->init(region_ind);
-    // Insert at front.
+    // Insert at front. The release_store publishes the initialized entry
+    // to get_entry_concurrent().
     int ind = (int) (region_ind & capacity_mask());
     res->set_next_index(_buckets[ind]);
-    _buckets[ind] = new_ind;
+    Atomic::release_store(&_buckets[ind], new_ind);
     _occupied_entries++;
   }
   return res;
 }
 
 int RSHashTable::alloc_entry() {
-  int res;
-  if (_free_list != NullEntry) {
-    res = _free_list;
-    _free_list = entry(res)->next_index();
-    return res;
-  } else if ((size_t)_free_region < _num_entries) {
-    res = _free_region;
-    _free_region++;
-    return res;
-  } else {
-    return NullEntry;
+  if ((size_t)_free_region < _num_entries) {
+    return _free_region++;
   }
-}
-
-void RSHashTable::free_entry(int fi) {
-  entry(fi)->set_next_index(_free_list);
-  _free_list = fi;
+  return NullEntry;
 }
 
 void RSHashTable::add_entry(SparsePRTEntry* e) {
@@ -244,6 +258,11 @@ bool RSHashTable::contains_card(RegionIdx_t region_index, CardIdx_t card_index)
   return (e != NULL && e->contains_card(card_index));
 }
 
+bool RSHashTable::contains_card_concurrent(RegionIdx_t region_index, CardIdx_t card_index) const {
+  SparsePRTEntry* e = get_entry_concurrent(region_index);
+  return (e != NULL && e->contains_card_concurrent(card_index));
+}
+
 size_t RSHashTable::mem_size() const {
   return sizeof(RSHashTable) +
     _num_entries * (SparsePRTEntry::size() + sizeof(int));
@@ -252,11 +271,13 @@ size_t RSHashTable::mem_size() const {
 // ----------------------------------------------------------------------
 
 SparsePRT::SparsePRT() :
-  _table(&RSHashTable::empty_table) {
+  _table(&RSHashTable::empty_table),
+  _retired_tables(NULL) {
 }
 
 
 SparsePRT::~SparsePRT() {
+  free_retired_tables();
   if (_table != &RSHashTable::empty_table) {
     delete _table;
   }
@@ -264,9 +285,19 @@ SparsePRT::~SparsePRT() {
 
 
 size_t SparsePRT::mem_size() const {
-  // We ignore "_cur" here, because it either = _next, or else it is
-  // on the deleted list.
-  return sizeof(SparsePRT) + _table->mem_size();
+  size_t sum = sizeof(SparsePRT) + _table->mem_size();
+  for (RSHashTable* t = _retired_tables; t != NULL; t = t->_retired_next) {
+    sum += t->mem_size();
+  }
+  return sum;
+}
+
+void SparsePRT::free_retired_tables() {
+  while (_retired_tables != NULL) {
+    RSHashTable* next = _retired_tables->_retired_next;
+    delete _retired_tables;
+    _retired_tables = next;
+  }
 }
 
 SparsePRT::AddCardResult SparsePRT::add_card(RegionIdx_t region_id, CardIdx_t card_index) {
@@ -284,7 +315,13 @@ bool SparsePRT::delete_entry(RegionIdx_t region_id) {
   return _table->delete_entry(region_id);
 }
 
+bool SparsePRT::contains_card_concurrent(RegionIdx_t region_id, CardIdx_t card_index) const {
+  // Pairs with the release_store in expand().
+  return Atomic::load_acquire(&_table)->contains_card_concurrent(region_id, card_index);
+}
+
 void SparsePRT::clear() {
+  free_retired_tables();
   // If the entry table not at initial capacity, just reset to the empty table.
   if (_table->capacity() == InitialCapacity) {
     _table->clear();
@@ -296,16 +333,25 @@ void SparsePRT::clear() {
 
 void SparsePRT::expand() {
   RSHashTable* last = _table;
+  RSHashTable* next;
   if (last != &RSHashTable::empty_table) {
-    _table = new RSHashTable(last->capacity() * 2);
-    for (size_t i = 0; i < last->num_entries(); i++) {
-      SparsePRTEntry* e = last->entry((int)i);
-      if (e->valid_entry()) {
-        _table->add_entry(e);
-      }
+    // Deleted entries are not reused, so the table may be full of them.
+    // Reclaim those instead of growing the table.
+    size_t capacity = last->capacity();
+    next = new RSHashTable(last->should_compact() ? capacity : capacity * 2);
+    // Only copy entries still linked into the table; deleted entries
+    // have been transferred to a PerRegionTable already.
+    RSHashTableBucketIter iter(last);
+    SparsePRTEntry* e;
+    while (iter.has_next(e)) {
+      next->add_entry(e);
     }
-    delete last;
+    // Concurrent readers may still be looking at the old table, so keep
+    // it alive until the next clear() or free_retired_tables().
+    last->_retired_next = _retired_tables;
+    _retired_tables = last;
   } else {
-    _table = new RSHashTable(InitialCapacity);
+    next = new RSHashTable(InitialCapacity);
   }
+  Atomic::release_store(&_table, next);
 }
@@ -39,11 +39,17 @@ class SparsePRTEntry;
 // Sparse remembered set for a heap region (the "owning" region).  Maps
 // indices of other regions to short sequences of cards in the other region
 // that might contain pointers into the owner region.
-// Concurrent access to a SparsePRT must be serialized by some external mutex.
+// Concurrent modification of a SparsePRT must be serialized by some external
+// mutex. Lookups via contains_card_concurrent() may run concurrently with
+// modifications: neither entries nor tables are reused or freed before the
+// next clear() or free_retired_tables(), which require that there are no
+// concurrent readers.
 class SparsePRT {
   friend class SparsePRTBucketIter;
 
-  RSHashTable* _table;
+  RSHashTable* volatile _table;
+  // Tables replaced by expand() that concurrent readers may still access.
+  RSHashTable* _retired_tables;
 
   static const size_t InitialCapacity = 8;
 
@@ -79,7 +85,16 @@ public:
   // Clear the table, and reinitialize to initial capacity.
   void clear();
 
+  // Free the tables replaced by expand(). Requires that there are no
+  // concurrent readers, e.g. at a safepoint.
+  void free_retired_tables();
+
   bool contains_card(RegionIdx_t region_id, CardIdx_t card_index) const;
+
+  // As contains_card(), but may be called without holding the external
+  // mutex. May spuriously return false if the card is being added or
+  // transferred concurrently; a true result is always correct.
+  bool contains_card_concurrent(RegionIdx_t region_id, CardIdx_t card_index) const;
 };
 
 class SparsePRTEntry: public CHeapObj<mtGC> {
@@ -94,9 +109,9 @@ private:
   // array elements required to get that alignment.
   static const size_t card_array_alignment = sizeof(int) / sizeof(card_elem_t);
 
-  RegionIdx_t _region_ind;
-  int         _next_index;
-  int         _next_null;
+  RegionIdx_t  _region_ind;
+  int          _next_index;
+  volatile int _next_null;
   // The actual cards stored in this array.
   // WARNING: Don't put any data members beyond this line. Card array has, in fact, variable length.
   // It should always be the last data member.
@@ -124,6 +139,8 @@ public:
 
   // Returns "true" iff the entry contains the given card index.
   inline bool contains_card(CardIdx_t card_index) const;
+  // As above, safe to use concurrently with add_card().
+  bool contains_card_concurrent(CardIdx_t card_index) const;
 
   // Returns the number of non-NULL card entries.
   inline int num_valid_cards() const { return _next_null; }
@@ -145,6 +162,7 @@ public:
 class RSHashTable : public CHeapObj<mtGC> {
 
   friend class RSHashTableBucketIter;
+  friend class SparsePRT;
 
   // Inverse maximum hash table occupancy used.
   static float TableOccupancyFactor;
@@ -157,8 +175,12 @@ class RSHashTable : public CHeapObj<mtGC> {
 
   SparsePRTEntry* _entries;
   int* _buckets;
+  // Entries are handed out in order and not reused until clear(), so that
+  // concurrent readers never observe an entry changing its region.
   int  _free_region;
-  int  _free_list;
+
+  // Link in the owning SparsePRT's list of retired tables.
+  RSHashTable* _retired_next;
 
   // Requires that the caller hold a lock preventing parallel modifying
   // operations, and that the the table be less than completely full.  If
@@ -169,9 +191,6 @@ class RSHashTable : public CHeapObj<mtGC> {
 
   // Returns the index of the next free entry in "_entries".
   int alloc_entry();
-  // Declares the entry "fi" to be free.  (It must have already been
-  // deleted from any bucket lists.
-  void free_entry(int fi);
 
   // For the empty sentinel created at static initialization time
   RSHashTable();
@@ -183,7 +202,10 @@ public:
   static const int NullEntry = -1;
   static RSHashTable empty_table;
 
-  bool should_expand() const { return _occupied_entries == _num_entries; }
+  bool should_expand() const { return (size_t)_free_region == _num_entries; }
+  // Returns whether at most half of the entries handed out are still in use,
+  // so that copying the table into one of the same capacity reclaims the rest.
+  bool should_compact() const { return _occupied_entries * 2 <= _num_entries; }
 
   // Attempts to ensure that the given card_index in the given region is in
   // the sparse table.  If successful (because the card was already
@@ -196,10 +218,14 @@ public:
   bool delete_entry(RegionIdx_t region_id);
 
   bool contains_card(RegionIdx_t region_id, CardIdx_t card_index) const;
+  bool contains_card_concurrent(RegionIdx_t region_id, CardIdx_t card_index) const;
 
   void add_entry(SparsePRTEntry* e);
 
   SparsePRTEntry* get_entry(RegionIdx_t region_id) const;
+  // Lookup that does not require the external mutex; may miss entries that
+  // are being inserted concurrently.
+  SparsePRTEntry* get_entry_concurrent(RegionIdx_t region_id) const;
 
   void clear();
 
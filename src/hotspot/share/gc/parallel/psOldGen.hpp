@@ -163,6 +163,13 @@ class PSOldGen : public CHeapObj<mtGC> {
   void oop_iterate(OopIterateClosure* cl) { object_space()->oop_iterate(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
 
+  // Parallel object iteration support. The used part of the generation is
+  // split into blocks of IterateBlockSize words that can be claimed and
+  // iterated independently; an object belongs to the block it starts in.
+  static const size_t IterateBlockSize = 1024 * 1024;
+  size_t num_iterable_blocks() const;
+  void object_iterate_block(ObjectClosure* cl, size_t block_index);
+
   // Debugging - do not use for time critical operations
   void print() const;
   virtual void print_on(outputStream* st) const;
@@ -2260,7 +2260,7 @@ void PSParallelCompact::adjust_roots(ParCompactionManager* cm) {
   PSScavenge::reference_processor()->weak_oops_do(&oop_closure);
 }
 
-// Helper class to print 8 region numbers per line and then print the total at the end.
+// Helper class to print 8 region numbers per line.
 class FillableRegionLogger : public StackObj {
 private:
   Log(gc, compaction) log;
@@ -2272,9 +2272,11 @@ private:
 public:
   FillableRegionLogger() : _next_index(0), _enabled(log_develop_is_enabled(Trace, gc, compaction)), _total_regions(0) { }
   ~FillableRegionLogger() {
-    log.trace(SIZE_FORMAT " initially fillable regions", _total_regions);
+    print_line();
   }
 
+  size_t total_regions() const { return _total_regions; }
+
   void print_line() {
     if (!_enabled || _next_index == 0) {
       return;
@@ -2288,6 +2290,7 @@ public:
   }
 
   void handle(size_t region) {
+    _total_regions++;
     if (!_enabled) {
       return;
     }
@@ -2295,50 +2298,86 @@ public:
     if (_next_index == LineLength) {
       print_line();
     }
-    _total_regions++;
   }
 };
 
-void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
-{
-  GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
-
-  // Find the threads that are active
-  uint worker_id = 0;
-
-  // Find all regions that are available (can be filled immediately) and
-  // distribute them to the thread stacks.  The iteration is done in reverse
-  // order (high to low) so the regions will be removed in ascending order.
+// Finds all regions that are available (can be filled immediately) and
+// pushes them to the region stack of the worker that found them. Workers
+// dynamically claim fixed-size chunks of regions, from the highest addresses
+// down, and scan each chunk in reverse order (high to low), so that every
+// worker removes its regions in ascending order.
+class FillableRegionsTask : public AbstractGangTask {
+  // Number of regions in a chunk claimed at a time.
+  static const size_t ChunkSize = 64;
+
+  const ParallelCompactData& _sd;
+  size_t _beg_region[PSParallelCompact::last_space_id];
+  size_t _end_region[PSParallelCompact::last_space_id];
+  volatile size_t _next_chunk[PSParallelCompact::last_space_id];
+  volatile size_t _total_regions;
+
+  bool claim_chunk(uint id, size_t& beg, size_t& end) {
+    const size_t chunk = Atomic::fetch_and_add(&_next_chunk[id], (size_t)1);
+    const size_t offset = chunk * ChunkSize;
+    if (offset >= _end_region[id] - _beg_region[id]) {
+      return false;
+    }
+    end = _end_region[id] - offset;
+    beg = MAX2(_beg_region[id], end - MIN2(end, ChunkSize));
+    return true;
+  }
 
-  const ParallelCompactData& sd = PSParallelCompact::summary_data();
+public:
+  FillableRegionsTask() :
+      AbstractGangTask("FillableRegionsTask"),
+      _sd(PSParallelCompact::summary_data()),
+      _total_regions(0) {
+    for (unsigned int id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      const PSParallelCompact::SpaceId space_id = PSParallelCompact::SpaceId(id);
+      _beg_region[id] = _sd.addr_to_region_idx(PSParallelCompact::dense_prefix(space_id));
+      _end_region[id] = _sd.addr_to_region_idx(_sd.region_align_up(PSParallelCompact::new_top(space_id)));
+      _next_chunk[id] = 0;
+    }
+  }
 
-  // id + 1 is used to test termination so unsigned  can
-  // be used with an old_space_id == 0.
-  FillableRegionLogger region_logger;
-  for (unsigned int id = to_space_id; id + 1 > old_space_id; --id) {
-    SpaceInfo* const space_info = _space_info + id;
-    MutableSpace* const space = space_info->space();
-    HeapWord* const new_top = space_info->new_top();
+  size_t total_regions() const { return _total_regions; }
 
-    const size_t beg_region = sd.addr_to_region_idx(space_info->dense_prefix());
-    const size_t end_region =
-      sd.addr_to_region_idx(sd.region_align_up(new_top));
-
-    for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
-      if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::manager_array(worker_id);
-        bool result = sd.region(cur)->mark_normal();
-        assert(result, "Must succeed at this point.");
-        cm->region_stack()->push(cur);
-        region_logger.handle(cur);
-        // Assign regions to tasks in round-robin fashion.
-        if (++worker_id == parallel_gc_threads) {
-          worker_id = 0;
+  virtual void work(uint worker_id) {
+    ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    FillableRegionLogger region_logger;
+
+    // id + 1 is used to test termination so unsigned  can
+    // be used with an old_space_id == 0.
+    for (unsigned int id = PSParallelCompact::to_space_id; id + 1 > PSParallelCompact::old_space_id; --id) {
+      size_t beg;
+      size_t end;
+      while (claim_chunk(id, beg, end)) {
+        for (size_t cur = end - 1; cur + 1 > beg; --cur) {
+          // Chunks are disjoint, and destination counts are not modified
+          // until compaction starts, so there is no need for atomic claiming.
+          if (_sd.region(cur)->claim_unsafe()) {
+            bool result = _sd.region(cur)->mark_normal();
+            assert(result, "Must succeed at this point.");
+            cm->region_stack()->push(cur);
+            region_logger.handle(cur);
+          }
         }
       }
+      region_logger.print_line();
     }
-    region_logger.print_line();
+
+    Atomic::add(&_total_regions, region_logger.total_regions());
   }
+};
+
+void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
+{
+  GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
+
+  FillableRegionsTask task;
+  ParallelScavengeHeap::heap()->workers().run_task(&task, parallel_gc_threads);
+
+  log_develop_trace(gc, compaction)(SIZE_FORMAT " initially fillable regions", task.total_regions());
 }
 
 class TaskQueue : StackObj {
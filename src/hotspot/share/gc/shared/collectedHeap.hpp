@@ -69,6 +69,16 @@ class GCMessage : public FormatBuffer<1024> {
 
 class CollectedHeap;
 
+// Iterates over the objects of the heap using multiple threads. Each
+// participating worker calls object_iterate() with its own worker id and
+// visits a disjoint part of the heap. Created by
+// CollectedHeap::parallel_object_iterator().
+class ParallelObjectIterator : public CHeapObj<mtGC> {
+ public:
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) = 0;
+  virtual ~ParallelObjectIterator() {}
+};
+
 class GCHeapLog : public EventLogBase<GCMessage> {
  private:
   void log_heap(CollectedHeap* heap, bool before);
@@ -386,6 +396,13 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl) = 0;
 
+  // Returns an iterator that lets thread_num workers iterate over all objects
+  // in parallel, or NULL if this heap does not support parallel iteration.
+  // Must be used at a safepoint; the caller owns the returned iterator.
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num) {
+    return NULL;
+  }
+
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
   virtual void keep_alive(oop obj) {}
 
@@ -250,6 +250,7 @@ void StringDedupTable::add(typeArrayOop value, bool latin1, unsigned int hash, S
   StringDedupEntry* entry = _entry_cache->alloc();
   entry->set_obj(value);
   entry->set_hash(hash);
+  entry->set_length(value->length());
   entry->set_latin1(latin1);
   entry->set_next(*list);
   *list = entry;
@@ -274,8 +275,10 @@ void StringDedupTable::transfer(StringDedupEntry** pentry, StringDedupTable* des
 
 typeArrayOop StringDedupTable::lookup(typeArrayOop value, bool latin1, unsigned int hash,
                                       StringDedupEntry** list, uintx &count) {
+  const int length = value->length();
   for (StringDedupEntry* entry = *list; entry != NULL; entry = entry->next()) {
-    if (entry->hash() == hash && entry->latin1() == latin1) {
+    // Only load and compare the array if hash, length and coder all match
+    if (entry->hash() == hash && entry->length() == length && entry->latin1() == latin1) {
       oop* obj_addr = (oop*)entry->obj_addr();
       oop obj = NativeAccess<ON_PHANTOM_OOP_REF | AS_NO_KEEPALIVE>::oop_load(obj_addr);
       if (java_lang_String::value_equals(value, static_cast<typeArrayOop>(obj))) {
@@ -609,6 +612,7 @@ void StringDedupTable::verify() {
       bool latin1 = (*entry)->latin1();
       unsigned int hash = hash_code(value, latin1);
       guarantee((*entry)->hash() == hash, "Table entry has inorrect hash");
+      guarantee((*entry)->length() == value->length(), "Table entry has incorrect length");
       guarantee(_table->hash_to_index(hash) == bucket, "Table entry has incorrect index");
       entry = (*entry)->next_addr();
     }
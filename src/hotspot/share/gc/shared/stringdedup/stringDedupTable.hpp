@@ -34,12 +34,15 @@ class StringDedupUnlinkOrOopsDoClosure;
 //
 // Table entry in the deduplication hashtable. Points weakly to the
 // character array. Can be chained in a linked list in case of hash
-// collisions or when placed in a freelist in the entry cache.
+// collisions or when placed in a freelist in the entry cache. The hash
+// and the array length are kept in the entry, so that lookups only need
+// to touch the array when both match.
 //
 class StringDedupEntry : public CHeapObj<mtGC> {
 private:
   StringDedupEntry* _next;
   unsigned int      _hash;
+  int               _length;
   bool              _latin1;
   typeArrayOop      _obj;
 
@@ -47,6 +50,7 @@ public:
   StringDedupEntry() :
     _next(NULL),
     _hash(0),
+    _length(0),
     _latin1(false),
     _obj(NULL) {
   }
@@ -71,6 +75,15 @@ public:
     _hash = hash;
   }
 
+  // Length of the array in bytes
+  int length() {
+    return _length;
+  }
+
+  void set_length(int length) {
+    _length = length;
+  }
+
   bool latin1() {
     return _latin1;
   }
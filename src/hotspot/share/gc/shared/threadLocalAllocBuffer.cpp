@@ -24,7 +24,10 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -56,6 +59,7 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   _allocated_before_last_gc = total_allocated;
 
   print_stats("gc");
+  post_statistics_event();
 
   if (_number_of_refills > 0) {
     // Update allocation history if a reasonable amount of eden was allocated.
@@ -287,6 +291,24 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _fast_refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::post_statistics_event() {
+  if (_number_of_refills == 0 && _slow_allocations == 0) {
+    return;
+  }
+  EventThreadTLABStatistics event;
+  if (event.should_commit()) {
+    event.set_gcId(GCId::current_or_undefined());
+    event.set_allocatingThread(JFR_THREAD_ID(thread()));
+    event.set_refills(_number_of_refills);
+    event.set_slowAllocations(_slow_allocations);
+    event.set_allocated(_allocated_size * HeapWordSize);
+    event.set_desiredSize(_desired_size * HeapWordSize);
+    event.set_gcWaste((size_t)_gc_waste * HeapWordSize);
+    event.set_refillWaste(((size_t)_slow_refill_waste + _fast_refill_waste) * HeapWordSize);
+    event.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::set_sample_end(bool reset_byte_accumulation) {
   size_t heap_words_remaining = pointer_delta(_end, _top);
   size_t bytes_until_sample = thread()->heap_sampler().bytes_until_sample();
@@ -99,6 +99,7 @@ private:
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
   void print_stats(const char* tag);
+  void post_statistics_event();
 
   Thread* thread();
 
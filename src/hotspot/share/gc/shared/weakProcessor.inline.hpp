@@ -166,13 +166,17 @@ void WeakProcessor::weak_oops_do(WorkGang* workers,
                                  IsAlive* is_alive,
                                  KeepAlive* keep_alive,
                                  WeakProcessorPhaseTimes* phase_times) {
-  WeakProcessorTimeTracker tt(phase_times);
+  {
+    WeakProcessorTimeTracker tt(phase_times);
 
-  uint nworkers = ergo_workers(MIN2(workers->active_workers(),
-                                    phase_times->max_threads()));
+    uint nworkers = ergo_workers(MIN2(workers->active_workers(),
+                                      phase_times->max_threads()));
 
-  GangTask task("Weak Processor", is_alive, keep_alive, phase_times, nworkers);
-  workers->run_task(&task, nworkers);
+    GangTask task("Weak Processor", is_alive, keep_alive, phase_times, nworkers);
+    workers->run_task(&task, nworkers);
+  }
+  // Not part of the recorded weak processing time.
+  phase_times->send_storage_events();
 }
 
 template<typename IsAlive, typename KeepAlive>
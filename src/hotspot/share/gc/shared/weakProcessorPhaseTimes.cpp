@@ -23,10 +23,12 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/weakProcessorPhases.hpp"
 #include "gc/shared/weakProcessorPhaseTimes.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "utilities/debug.hpp"
@@ -189,6 +191,21 @@ void WeakProcessorPhaseTimes::record_worker_items(uint worker_id,
   phase_data->set_or_add_thread_work_item(worker_id, num_total, TotalItems);
 }
 
+void WeakProcessorPhaseTimes::send_storage_events() const {
+  typedef WeakProcessorPhases::Iterator Iterator;
+  for (Iterator it = WeakProcessorPhases::oopstorage_iterator(); !it.is_end(); ++it) {
+    EventGCWeakStorageStatistics e;
+    if (e.should_commit()) {
+      WorkerDataArray<double>* data = worker_data(*it);
+      e.set_gcId(GCId::current_or_undefined());
+      e.set_name(data->title());
+      e.set_dead(data->thread_work_items(DeadItems)->sum());
+      e.set_total(data->thread_work_items(TotalItems)->sum());
+      e.commit();
+    }
+  }
+}
+
 static double elapsed_time_sec(Ticks start_time, Ticks end_time) {
   return (end_time - start_time).seconds();
 }
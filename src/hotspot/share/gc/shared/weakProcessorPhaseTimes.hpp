@@ -86,6 +86,9 @@ public:
 
   void log_print(uint indent = 0) const;
   void log_print_phases(uint indent = 0) const;
+
+  // Send the dead and total entry counts of each weak OopStorage to JFR.
+  void send_storage_events() const;
 };
 
 // Record total weak processor time and worker count in times.
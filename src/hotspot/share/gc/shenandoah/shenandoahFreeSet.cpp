@@ -356,11 +356,27 @@ void ShenandoahFreeSet::recycle_trash() {
   // lock is not reentrable, check we don't have it
   shenandoah_assert_not_heaplocked();
 
-  for (size_t i = 0; i < _heap->num_regions(); i++) {
-    ShenandoahHeapRegion* r = _heap->get_region(i);
-    if (r->is_trash()) {
+  // Recycling a region is cheap, so taking the heap lock for every trashed
+  // region mostly adds lock traffic on heaps with many regions. Recycle them
+  // in small batches instead: the lock is still held only briefly, and
+  // allocators get a chance to take it between batches.
+  const size_t batch_size = 32;
+  ShenandoahHeapRegion* batch[batch_size];
+
+  size_t i = 0;
+  while (i < _heap->num_regions()) {
+    size_t count = 0;
+    while (i < _heap->num_regions() && count < batch_size) {
+      ShenandoahHeapRegion* r = _heap->get_region(i++);
+      if (r->is_trash()) {
+        batch[count++] = r;
+      }
+    }
+    if (count > 0) {
       ShenandoahHeapLocker locker(_heap->lock());
-      try_recycle_trashed(r);
+      for (size_t j = 0; j < count; j++) {
+        try_recycle_trashed(batch[j]);
+      }
     }
     SpinPause(); // allow allocators to take the lock
   }
@@ -27,6 +27,7 @@
 
 #include "gc/shenandoah/shenandoahNumberSeq.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
+#include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "memory/allocation.hpp"
 
 class ShenandoahHeap;
@@ -39,6 +40,8 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * A thread that can not get credit claims it anyway, going into debt, and then waits
+ * until GC progress repays the debt, or until the maximum pacing delay expires.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -61,6 +64,10 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Set when the budget is replenished beyond zero, cleared when waiters are notified
+  ShenandoahSharedFlag _need_notify_waiters;
+  shenandoah_padding(4);
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -91,18 +98,25 @@ public:
 
   intptr_t epoch();
 
+  // Wake up threads waiting for their pacing debt to be repaid, if the budget
+  // became positive since the last call.
+  void notify_waiters();
+
   void print_on(outputStream* out) const;
+  // Prints the per-thread pacing delays accrued since the last call, and resets them.
+  void print_cycle_on(outputStream* out);
 
 private:
   inline void report_internal(size_t words);
   inline void report_progress_internal(size_t words);
 
+  inline void add_budget(size_t words);
+
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
   size_t update_and_get_progress_history();
 
   void wait(size_t time_ms);
-  void notify_waiters();
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHPACER_HPP
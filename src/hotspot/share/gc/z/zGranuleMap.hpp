@@ -29,10 +29,14 @@
 template<typename T>
 class ZGranuleMapIterator;
 
+template<typename T>
+class ZGranuleMapParallelIterator;
+
 template <typename T>
 class ZGranuleMap {
   friend class VMStructs;
   friend class ZGranuleMapIterator<T>;
+  friend class ZGranuleMapParallelIterator<T>;
 
 private:
   const size_t _size;
@@ -62,4 +66,23 @@ public:
   bool next(T** value);
 };
 
+template <typename T>
+class ZGranuleMapParallelIterator : public StackObj {
+private:
+  // Granules claimed at a time, to keep workers from
+  // contending on the claim counter for every granule
+  static const size_t ClaimGranules = 64;
+
+  const ZGranuleMap<T>* const _map;
+  volatile size_t             _claimed;
+
+public:
+  ZGranuleMapParallelIterator(const ZGranuleMap<T>* map);
+
+  // Claims the granules with index [*start, *end)
+  bool claim(size_t* start, size_t* end);
+
+  T at(size_t index) const;
+};
+
 #endif // SHARE_GC_Z_ZGRANULEMAP_HPP
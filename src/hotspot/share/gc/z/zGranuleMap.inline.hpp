@@ -27,6 +27,7 @@
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zGranuleMap.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -100,4 +101,33 @@ inline bool ZGranuleMapIterator<T>::next(T** value) {
   return false;
 }
 
+template <typename T>
+inline ZGranuleMapParallelIterator<T>::ZGranuleMapParallelIterator(const ZGranuleMap<T>* map) :
+    _map(map),
+    _claimed(0) {}
+
+template <typename T>
+inline bool ZGranuleMapParallelIterator<T>::claim(size_t* start, size_t* end) {
+  if (Atomic::load(&_claimed) >= _map->_size) {
+    // End of map, avoid further updates of the claim counter
+    return false;
+  }
+
+  const size_t claimed = Atomic::fetch_and_add(&_claimed, ClaimGranules);
+  if (claimed < _map->_size) {
+    *start = claimed;
+    *end = MIN2(claimed + ClaimGranules, _map->_size);
+    return true;
+  }
+
+  // End of map
+  return false;
+}
+
+template <typename T>
+inline T ZGranuleMapParallelIterator<T>::at(size_t index) const {
+  assert(index < _map->_size, "Invalid index");
+  return _map->_map[index];
+}
+
 #endif // SHARE_GC_Z_ZGRANULEMAP_INLINE_HPP
@@ -28,6 +28,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
 #include "gc/z/zHeuristics.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -35,6 +36,7 @@
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zResurrection.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zTask.hpp"
 #include "gc/z/zThread.inline.hpp"
 #include "gc/z/zVerify.hpp"
 #include "gc/z/zWorkers.inline.hpp"
@@ -349,30 +351,61 @@ void ZHeap::process_non_strong_references() {
   _reference_processor.enqueue_references();
 }
 
+class ZRegisterRelocatablePagesTask : public ZTask {
+private:
+  ZHeap* const               _heap;
+  ZPageTableParallelIterator _iter;
+  ZRelocationSetSelector*    _selector;
+  ZLock                      _lock;
+
+public:
+  ZRegisterRelocatablePagesTask(ZHeap* heap, ZPageTable* page_table, ZRelocationSetSelector* selector) :
+      ZTask("ZRegisterRelocatablePagesTask"),
+      _heap(heap),
+      _iter(page_table),
+      _selector(selector),
+      _lock() {}
+
+  virtual void work() {
+    // Register pages with a worker local selector, to avoid
+    // synchronizing on every page
+    ZRelocationSetSelector selector;
+
+    for (size_t start, end; _iter.claim(&start, &end);) {
+      for (size_t index = start; index < end; index++) {
+        ZPage* const page = _iter.page_starting_at(index);
+        if (page == NULL || !page->is_relocatable()) {
+          // No page starts here, or not relocatable, don't register
+          continue;
+        }
+
+        if (page->is_marked()) {
+          // Register live page
+          selector.register_live_page(page);
+        } else {
+          // Register garbage page
+          selector.register_garbage_page(page);
+
+          // Reclaim page immediately
+          _heap->free_page(page, true /* reclaimed */);
+        }
+      }
+    }
+
+    // Combine with the other workers' pages
+    ZLocker<ZLock> locker(&_lock);
+    _selector->merge(&selector);
+  }
+};
+
 void ZHeap::select_relocation_set() {
   // Do not allow pages to be deleted
   _page_allocator.enable_deferred_delete();
 
   // Register relocatable pages with selector
   ZRelocationSetSelector selector;
-  ZPageTableIterator pt_iter(&_page_table);
-  for (ZPage* page; pt_iter.next(&page);) {
-    if (!page->is_relocatable()) {
-      // Not relocatable, don't register
-      continue;
-    }
-
-    if (page->is_marked()) {
-      // Register live page
-      selector.register_live_page(page);
-    } else {
-      // Register garbage page
-      selector.register_garbage_page(page);
-
-      // Reclaim page immediately
-      free_page(page, true /* reclaimed */);
-    }
-  }
+  ZRegisterRelocatablePagesTask task(this, &_page_table, &selector);
+  _workers.run_concurrent(&task);
 
   // Allow pages to be deleted
   _page_allocator.disable_deferred_delete();
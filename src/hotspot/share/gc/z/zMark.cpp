@@ -71,7 +71,9 @@ ZMark::ZMark(ZWorkers* workers, ZPageTable* page_table) :
     _nterminateflush(0),
     _ntrycomplete(0),
     _ncontinue(0),
-    _nworkers(0) {}
+    _nworkers(0),
+    _stripe_ndrained(),
+    _stripe_nstolen() {}
 
 bool ZMark::is_initialized() const {
   return _allocator.is_initialized();
@@ -96,6 +98,12 @@ void ZMark::prepare_mark() {
   _ntrycomplete = 0;
   _ncontinue = 0;
 
+  // Reset stripe statistics
+  for (size_t i = 0; i < ZMarkStripesMax; i++) {
+    _stripe_ndrained[i] = 0;
+    _stripe_nstolen[i] = 0;
+  }
+
   // Set number of workers to use
   _nworkers = _workers->nconcurrent();
 
@@ -371,20 +379,26 @@ void ZMark::mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry) {
 template <typename T>
 bool ZMark::drain(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks, ZMarkCache* cache, T* timeout) {
   ZMarkStackEntry entry;
+  size_t ndrained = 0;
+  bool success = true;
 
   // Drain stripe stacks
   while (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
     mark_and_follow(cache, entry);
+    ndrained++;
 
     // Check timeout
     if (timeout->has_expired()) {
       // Timeout
-      return false;
+      success = false;
+      break;
     }
   }
 
-  // Success
-  return true;
+  // Update statistics
+  Atomic::add(&_stripe_ndrained[_stripes.stripe_id(stripe)], ndrained);
+
+  return success;
 }
 
 template <typename T>
@@ -406,6 +420,7 @@ bool ZMark::try_steal(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks) {
     if (stack != NULL) {
       // Success, install the stolen stack
       stacks->install(&_stripes, stripe, stack);
+      Atomic::inc(&_stripe_nstolen[_stripes.stripe_id(stripe)]);
       return true;
     }
   }
@@ -721,6 +736,17 @@ bool ZMark::try_end() {
   return try_complete();
 }
 
+void ZMark::print_stripe_statistics() const {
+  LogTarget(Debug, gc, marking) log;
+  if (log.is_enabled()) {
+    log.print("Mark Stripe Statistics");
+    for (size_t i = 0; i < _stripes.nstripes(); i++) {
+      log.print("  Stripe " SIZE_FORMAT "(" SIZE_FORMAT "): " SIZE_FORMAT " entries drained, " SIZE_FORMAT " stacks stolen",
+                i, _stripes.nstripes(), Atomic::load(&_stripe_ndrained[i]), Atomic::load(&_stripe_nstolen[i]));
+    }
+  }
+}
+
 bool ZMark::end() {
   // Try end marking
   if (!try_end()) {
@@ -736,6 +762,7 @@ bool ZMark::end() {
 
   // Update statistics
   ZStatMark::set_at_mark_end(_nproactiveflush, _nterminateflush, _ntrycomplete, _ncontinue);
+  print_stripe_statistics();
 
   // Mark completed
   return true;
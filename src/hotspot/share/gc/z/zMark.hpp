@@ -55,8 +55,14 @@ private:
   size_t              _ncontinue;
   uint                _nworkers;
 
+  // Per stripe statistics, used to detect imbalance between stripes. Indexed
+  // by the stripe of the worker doing the work, not the stripe of the work.
+  volatile size_t     _stripe_ndrained[ZMarkStripesMax];
+  volatile size_t     _stripe_nstolen[ZMarkStripesMax];
+
   size_t calculate_nstripes(uint nworkers) const;
   void prepare_mark();
+  void print_stripe_statistics() const;
 
   bool is_array(uintptr_t addr) const;
   void push_partial_array(uintptr_t addr, size_t size, bool finalizable);
@@ -32,6 +32,7 @@ class ZPage;
 class ZPageTable {
   friend class VMStructs;
   friend class ZPageTableIterator;
+  friend class ZPageTableParallelIterator;
 
 private:
   ZGranuleMap<ZPage*> _map;
@@ -56,4 +57,18 @@ public:
   bool next(ZPage** page);
 };
 
+class ZPageTableParallelIterator : public StackObj {
+private:
+  ZGranuleMapParallelIterator<ZPage*> _iter;
+
+public:
+  ZPageTableParallelIterator(const ZPageTable* page_table);
+
+  // Claims the granules with index [*start, *end)
+  bool claim(size_t* start, size_t* end);
+
+  // Returns the page starting at the given granule, or NULL
+  ZPage* page_starting_at(size_t index) const;
+};
+
 #endif // SHARE_GC_Z_ZPAGETABLE_HPP
@@ -26,6 +26,7 @@
 
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGranuleMap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.hpp"
 
 inline ZPage* ZPageTable::get(uintptr_t addr) const {
@@ -50,4 +51,23 @@ inline bool ZPageTableIterator::next(ZPage** page) {
   return false;
 }
 
+inline ZPageTableParallelIterator::ZPageTableParallelIterator(const ZPageTable* page_table) :
+    _iter(&page_table->_map) {}
+
+inline bool ZPageTableParallelIterator::claim(size_t* start, size_t* end) {
+  return _iter.claim(start, end);
+}
+
+inline ZPage* ZPageTableParallelIterator::page_starting_at(size_t index) const {
+  ZPage* const page = _iter.at(index);
+
+  // A page covering several granules is only returned for its first
+  // granule, so that each page is returned exactly once.
+  if (page != NULL && page->start() == (index << ZGranuleSizeShift)) {
+    return page;
+  }
+
+  return NULL;
+}
+
 #endif // SHARE_GC_Z_ZPAGETABLE_INLINE_HPP
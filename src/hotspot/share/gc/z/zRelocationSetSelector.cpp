@@ -84,6 +84,24 @@ void ZRelocationSetSelectorGroup::register_garbage_page(ZPage* page) {
   _stats._empty += size;
 }
 
+void ZRelocationSetSelectorGroup::merge(ZRelocationSetSelectorGroup* other) {
+  assert(_page_type == other->_page_type, "Invalid group");
+  assert(_sorted_pages == NULL && other->_sorted_pages == NULL, "Already selected");
+
+  ZArrayIterator<ZPage*> iter(&other->_registered_pages);
+  for (ZPage* page; iter.next(&page);) {
+    _registered_pages.add(page);
+  }
+  other->_registered_pages.clear();
+
+  _stats._npages += other->_stats._npages;
+  _stats._total += other->_stats._total;
+  _stats._live += other->_stats._live;
+  _stats._garbage += other->_stats._garbage;
+  _stats._empty += other->_stats._empty;
+  other->_stats = ZRelocationSetSelectorGroupStats();
+}
+
 bool ZRelocationSetSelectorGroup::is_disabled() {
   // Medium pages are disabled when their page size is zero
   return _page_type == ZPageTypeMedium && _page_size == 0;
@@ -230,6 +248,12 @@ void ZRelocationSetSelector::register_garbage_page(ZPage* page) {
   }
 }
 
+void ZRelocationSetSelector::merge(ZRelocationSetSelector* other) {
+  _small.merge(&other->_small);
+  _medium.merge(&other->_medium);
+  _large.merge(&other->_large);
+}
+
 void ZRelocationSetSelector::select(ZRelocationSet* relocation_set) {
   // Select pages to relocate. The resulting relocation set will be
   // sorted such that medium pages comes first, followed by small
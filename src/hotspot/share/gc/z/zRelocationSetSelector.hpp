@@ -95,6 +95,7 @@ public:
 
   void register_live_page(ZPage* page);
   void register_garbage_page(ZPage* page);
+  void merge(ZRelocationSetSelectorGroup* other);
   void select();
 
   ZPage* const* selected() const;
@@ -119,6 +120,9 @@ public:
 
   void register_live_page(ZPage* page);
   void register_garbage_page(ZPage* page);
+  // Moves all pages registered with other into this selector. Used to
+  // combine selectors that were populated in parallel.
+  void merge(ZRelocationSetSelector* other);
   void select(ZRelocationSet* relocation_set);
 
   ZRelocationSetSelectorStats stats() const;
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/signature.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -434,7 +435,10 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
 
-OopMapCache::OopMapCache() {
+// Classes with many methods get more entries, so that the oop maps of
+// their interpreted frames do not keep evicting each other.
+OopMapCache::OopMapCache(int num_methods) :
+  _size(clamp(round_up_power_of_2(MAX2(num_methods, 1)), (int)_min_size, (int)_max_size)) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
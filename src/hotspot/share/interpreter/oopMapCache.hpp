@@ -147,10 +147,12 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _min_size    = 32,     // size for classes with few methods
+         _max_size    = 512,    // upper bound on the size of one cache
          _probe_depth = 3       // probe depth in case of collisions
   };
 
+  const int _size;
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
@@ -162,7 +164,8 @@ class OopMapCache : public CHeapObj<mtClass> {
   void flush();
 
  public:
-  OopMapCache();
+  // The cache is sized from the number of methods of its class.
+  OopMapCache(int num_methods);
   ~OopMapCache();                                // free up memory
 
   // flush cache entry is occupied by an obsolete method
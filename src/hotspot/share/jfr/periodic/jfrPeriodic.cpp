@@ -62,7 +62,11 @@
 #include "runtime/vmThread.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/management.hpp"
+#include "services/mallocTracker.hpp"
+#include "services/memTracker.hpp"
 #include "services/threadService.hpp"
+#include "services/threadStackTracker.hpp"
+#include "services/virtualMemoryTracker.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 #if INCLUDE_G1GC
@@ -461,6 +465,54 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+// One event per memory category, accounted the same way as the
+// summary report of jcmd VM.native_memory.
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+#if INCLUDE_NMT
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  MallocMemorySnapshot malloc_snapshot;
+  VirtualMemorySnapshot vm_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  VirtualMemorySummary::snapshot(&vm_snapshot);
+
+  for (int index = 0; index < mt_number_of_types; index++) {
+    MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    if (flag == mtThreadStack) {
+      // Reported as part of mtThread
+      continue;
+    }
+    const MallocMemory* malloc_memory = malloc_snapshot.by_type(flag);
+    const VirtualMemory* virtual_memory = vm_snapshot.by_type(flag);
+    size_t reserved = malloc_memory->malloc_size() + malloc_memory->arena_size() + virtual_memory->reserved();
+    size_t committed = malloc_memory->malloc_size() + malloc_memory->arena_size() + virtual_memory->committed();
+    if (flag == mtThread) {
+      if (ThreadStackTracker::track_as_vm()) {
+        reserved += vm_snapshot.by_type(mtThreadStack)->reserved();
+        committed += vm_snapshot.by_type(mtThreadStack)->committed();
+      } else {
+        reserved += malloc_snapshot.by_type(mtThreadStack)->malloc_size();
+        committed += malloc_snapshot.by_type(mtThreadStack)->malloc_size();
+      }
+    } else if (flag == mtNMT) {
+      reserved += malloc_snapshot.malloc_overhead()->size();
+      committed += malloc_snapshot.malloc_overhead()->size();
+    }
+    if (reserved == 0) {
+      continue;
+    }
+    EventNativeMemoryUsage event;
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(reserved);
+    event.set_committed(committed);
+    event.set_mallocPeak(malloc_memory->malloc_peak_size());
+    event.set_arenaPeak(malloc_memory->arena_peak_size());
+    event.commit();
+  }
+#endif // INCLUDE_NMT
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -596,6 +648,7 @@ TRACE_REQUEST_FUNC(CodeCacheStatistics) {
       event.set_methodCount(CodeCache::nmethod_count(bt));
       event.set_adaptorCount(CodeCache::adapter_count(bt));
       event.set_unallocatedCapacity(CodeCache::unallocated_capacity(bt));
+      event.set_freeBlockCount(CodeCache::get_code_heap(bt)->freelist_length());
       event.set_fullCount(CodeCache::get_codemem_full_count(bt));
       event.commit();
     }
@@ -484,10 +484,6 @@ static bool prepare_for_emergency_dump(Thread* thread) {
   if (JfrBuffer_lock->owned_by_self()) {
     JfrBuffer_lock->unlock();
   }
-
-  if (JfrStacktrace_lock->owned_by_self()) {
-    JfrStacktrace_lock->unlock();
-  }
   return true;
 }
 
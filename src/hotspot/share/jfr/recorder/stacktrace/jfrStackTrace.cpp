@@ -48,7 +48,6 @@ JfrStackFrame::JfrStackFrame(const traceid& id, int bci, int type, int lineno, c
   _klass(ik), _methodid(id), _line(lineno), _bci(bci), _type(type) {}
 
 JfrStackTrace::JfrStackTrace(JfrStackFrame* frames, u4 max_frames) :
-  _next(NULL),
   _frames(frames),
   _id(0),
   _hash(0),
@@ -59,8 +58,7 @@ JfrStackTrace::JfrStackTrace(JfrStackFrame* frames, u4 max_frames) :
   _lineno(false),
   _written(false) {}
 
-JfrStackTrace::JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackTrace* next) :
-  _next(next),
+JfrStackTrace::JfrStackTrace(traceid id, const JfrStackTrace& trace) :
   _frames(NULL),
   _id(id),
   _hash(trace._hash),
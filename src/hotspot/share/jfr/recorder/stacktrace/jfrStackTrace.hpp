@@ -63,13 +63,15 @@ class JfrStackFrame {
 
 class JfrStackTrace : public JfrCHeapObj {
   friend class JfrNativeSamplerCallback;
+  friend class JfrStackTraceLookup;
   friend class JfrStackTraceRepository;
+  friend class JfrStackTraceTableConfig;
+  friend class JfrStackTraceWriter;
   friend class ObjectSampleCheckpoint;
   friend class ObjectSampler;
   friend class OSThreadSampler;
   friend class StackTraceResolver;
  private:
-  const JfrStackTrace* _next;
   JfrStackFrame* _frames;
   traceid _id;
   unsigned int _hash;
@@ -80,8 +82,6 @@ class JfrStackTrace : public JfrCHeapObj {
   mutable bool _lineno;
   mutable bool _written;
 
-  const JfrStackTrace* next() const { return _next; }
-
   bool should_write() const { return !_written; }
   void write(JfrChunkWriter& cw) const;
   void write(JfrCheckpointWriter& cpw) const;
@@ -99,7 +99,7 @@ class JfrStackTrace : public JfrCHeapObj {
   bool have_lineno() const { return _lineno; }
   bool full_stacktrace() const { return _reached_root; }
 
-  JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackTrace* next);
+  JfrStackTrace(traceid id, const JfrStackTrace& trace);
   JfrStackTrace(JfrStackFrame* frames, u4 max_frames);
   ~JfrStackTrace();
 
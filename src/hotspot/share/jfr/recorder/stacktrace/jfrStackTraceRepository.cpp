@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,12 +28,84 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
-#include "runtime/mutexLocker.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
 
 static JfrStackTraceRepository* _instance = NULL;
 
-JfrStackTraceRepository::JfrStackTraceRepository() : _next_id(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+// Prefer short chains of avg 2
+static const double PREF_AVG_LIST_LEN = 2.0;
+
+uintx JfrStackTraceTableConfig::get_hash(Value const& value, bool* is_dead) {
+  return value->hash();
+}
+
+void* JfrStackTraceTableConfig::allocate_node(size_t size, Value const& value) {
+  JfrStackTraceRepository::entry_added();
+  return AllocateHeap(size, mtTracing);
+}
+
+void JfrStackTraceTableConfig::free_node(void* memory, Value const& value) {
+  delete value;
+  FreeHeap(memory);
+  JfrStackTraceRepository::entry_removed();
+}
+
+// Finds the entry equal to a recorded stack trace.
+class JfrStackTraceLookup : public StackObj {
+ private:
+  const JfrStackTrace& _stacktrace;
+ public:
+  JfrStackTraceLookup(const JfrStackTrace& stacktrace) : _stacktrace(stacktrace) {}
+  uintx get_hash() const {
+    return _stacktrace.hash();
+  }
+  bool equals(JfrStackTrace** value, bool* is_dead) {
+    return (*value)->equals(_stacktrace);
+  }
+};
+
+// Finds the entry with a given id.
+class JfrStackTraceIdLookup : public StackObj {
+ private:
+  unsigned int _hash;
+  traceid _id;
+ public:
+  JfrStackTraceIdLookup(unsigned int hash, traceid id) : _hash(hash), _id(id) {}
+  uintx get_hash() const {
+    return _hash;
+  }
+  bool equals(JfrStackTrace** value, bool* is_dead) {
+    return (*value)->id() == _id;
+  }
+};
+
+class JfrStackTraceGet : public StackObj {
+ private:
+  const JfrStackTrace* _result;
+  traceid _id;
+ public:
+  JfrStackTraceGet() : _result(NULL), _id(0) {}
+  void operator()(JfrStackTrace** value) {
+    _result = *value;
+    _id = _result->id();
+  }
+  const JfrStackTrace* result() const { return _result; }
+  // The id is captured inside the critical section of the lookup.
+  traceid id() const { return _id; }
+};
+
+JfrStackTraceRepository::JfrStackTraceRepository() :
+  _table(new JfrStackTraceTable(TABLE_SIZE_LOG2, TABLE_MAX_SIZE_LOG2)),
+  _next_id(0),
+  _entries(0),
+  _hits(0),
+  _misses(0) {}
+
+JfrStackTraceRepository::~JfrStackTraceRepository() {
+  delete _table;
 }
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
@@ -74,54 +146,106 @@ void JfrStackTraceRepository::destroy() {
 static traceid last_id = 0;
 
 bool JfrStackTraceRepository::is_modified() const {
-  return last_id != _next_id;
+  return last_id != Atomic::load(&_next_id);
+}
+
+void JfrStackTraceRepository::entry_added() {
+  Atomic::inc(&instance()._entries);
+}
+
+void JfrStackTraceRepository::entry_removed() {
+  Atomic::dec(&instance()._entries);
+}
+
+size_t JfrStackTraceRepository::hits() {
+  return Atomic::load(&instance()._hits);
+}
+
+size_t JfrStackTraceRepository::misses() {
+  return Atomic::load(&instance()._misses);
+}
+
+class JfrStackTraceWriter : public StackObj {
+ private:
+  JfrChunkWriter& _cw;
+  size_t _count;
+ public:
+  JfrStackTraceWriter(JfrChunkWriter& cw) : _cw(cw), _count(0) {}
+  bool operator()(JfrStackTrace** value) {
+    const JfrStackTrace* const stacktrace = *value;
+    if (stacktrace->should_write()) {
+      stacktrace->write(_cw);
+      ++_count;
+    }
+    return true;
+  }
+  size_t count() const { return _count; }
+};
+
+class JfrStackTraceDeleteAll : public StackObj {
+ public:
+  bool operator()(JfrStackTrace** value) {
+    return true;
+  }
+};
+
+// Resizing is left to the recorder thread, so that threads recording
+// stack traces never have to wait for it.
+void JfrStackTraceRepository::grow_if_needed() {
+  assert(!SafepointSynchronize::is_at_safepoint(), "invariant");
+  Thread* const thread = Thread::current();
+  const size_t size = (size_t)1 << _table->get_size_log2(thread);
+  if ((double)Atomic::load(&_entries) / size > PREF_AVG_LIST_LEN && !_table->is_max_size_reached()) {
+    if (_table->grow(thread)) {
+      log_debug(jfr, system, stacktrace)("Stack trace table grown to " SIZE_FORMAT " buckets",
+                                         (size_t)1 << _table->get_size_log2(thread));
+    }
+  }
+}
+
+// Removes all entries.
+void JfrStackTraceRepository::clear_table() {
+  if (SafepointSynchronize::is_at_safepoint()) {
+    // No other thread uses the table; replace it with an empty one of the same size.
+    assert(Thread::current()->is_VM_thread(), "invariant");
+    const size_t size_log2 = _table->get_size_log2(Thread::current());
+    delete _table;
+    _table = new JfrStackTraceTable(size_log2, TABLE_MAX_SIZE_LOG2);
+  } else {
+    JfrStackTraceDeleteAll delete_all;
+    _table->bulk_delete(Thread::current(), delete_all, delete_all);
+  }
 }
 
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
-  if (_entries == 0) {
+  if (Atomic::load(&_entries) == 0) {
     return 0;
   }
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
-  int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
-      }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
-    }
+  const traceid next_id = Atomic::load(&_next_id);
+  JfrStackTraceWriter writer(sw);
+  if (SafepointSynchronize::is_at_safepoint()) {
+    _table->do_safepoint_scan(writer);
+  } else {
+    _table->do_scan(Thread::current(), writer);
   }
+  log_debug(jfr, system, stacktrace)("Stack traces written: " SIZE_FORMAT ", entries: " SIZE_FORMAT
+                                     ", hits: " SIZE_FORMAT ", misses: " SIZE_FORMAT,
+                                     writer.count(), Atomic::load(&_entries), hits(), misses());
   if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    clear_table();
+  } else if (!SafepointSynchronize::is_at_safepoint()) {
+    grow_if_needed();
   }
-  last_id = _next_id;
-  return count;
+  last_id = next_id;
+  return writer.count();
 }
 
 size_t JfrStackTraceRepository::clear() {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (_entries == 0) {
+  const size_t processed = Atomic::load(&_entries);
+  if (processed == 0) {
     return 0;
   }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
-    }
-  }
-  memset(_table, 0, sizeof(_table));
-  const size_t processed = _entries;
-  _entries = 0;
+  clear_table();
   return processed;
 }
 
@@ -174,34 +298,35 @@ void JfrStackTraceRepository::record_and_cache(JavaThread* thread, int skip /* 0
 }
 
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+  Thread* const thread = Thread::current();
+  JfrStackTraceLookup lookup(stacktrace);
+  JfrStackTraceGet get;
+  while (true) {
+    if (_table->get(thread, lookup, get)) {
+      Atomic::inc(&_hits);
+      return get.id();
+    }
 
-  while (table_entry != NULL) {
-    if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+    if (!stacktrace.have_lineno()) {
+      return 0;
     }
-    table_entry = table_entry->next();
-  }
 
-  if (!stacktrace.have_lineno()) {
-    return 0;
+    const traceid id = Atomic::add(&_next_id, (traceid)1);
+    if (_table->insert(thread, lookup, new JfrStackTrace(id, stacktrace))) {
+      Atomic::inc(&_misses);
+      return id;
+    }
+    // Another thread inserted an equal stack trace concurrently and the table
+    // has freed our entry. Retry the lookup to use the id of the other one.
   }
-
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
-  return id;
 }
 
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup(unsigned int hash, traceid id) const {
-  const size_t index = (hash % TABLE_SIZE);
-  const JfrStackTrace* trace = _table[index];
-  while (trace != NULL && trace->id() != id) {
-    trace = trace->next();
-  }
+  JfrStackTraceIdLookup lookup(hash, id);
+  JfrStackTraceGet get;
+  _table->get(Thread::current(), lookup, get);
+  const JfrStackTrace* const trace = get.result();
   assert(trace != NULL, "invariant");
   assert(trace->hash() == hash, "invariant");
   assert(trace->id() == id, "invariant");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,14 +28,26 @@
 #include "jfr/recorder/stacktrace/jfrStackTrace.hpp"
 #include "jfr/utilities/jfrAllocation.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
+#include "utilities/concurrentHashTable.hpp"
 
 class JavaThread;
 class JfrCheckpointWriter;
 class JfrChunkWriter;
 
+class JfrStackTraceTableConfig : public AllStatic {
+ public:
+  typedef JfrStackTrace* Value;
+  static uintx get_hash(Value const& value, bool* is_dead);
+  static void* allocate_node(size_t size, Value const& value);
+  static void free_node(void* memory, Value const& value);
+};
+
+typedef ConcurrentHashTable<JfrStackTraceTableConfig, mtTracing> JfrStackTraceTable;
+
 class JfrStackTraceRepository : public JfrCHeapObj {
   friend class JfrRecorder;
   friend class JfrRecorderService;
+  friend class JfrStackTraceTableConfig;
   friend class JfrThreadSampleClosure;
   friend class ObjectSampleCheckpoint;
   friend class ObjectSampler;
@@ -43,12 +55,19 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   friend class StackTraceRepository;
 
  private:
-  static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
-  traceid _next_id;
-  u4 _entries;
+  // The table starts at 2^TABLE_SIZE_LOG2 buckets and is grown by the
+  // recorder thread when the chains become long, up to 2^TABLE_MAX_SIZE_LOG2.
+  static const size_t TABLE_SIZE_LOG2 = 11;
+  static const size_t TABLE_MAX_SIZE_LOG2 = 24;
+  JfrStackTraceTable* _table;
+  volatile traceid _next_id;
+  volatile size_t _entries;
+  // Stack trace de-duplication statistics.
+  volatile size_t _hits;
+  volatile size_t _misses;
 
   JfrStackTraceRepository();
+  ~JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
   static JfrStackTraceRepository* create();
   static void destroy();
@@ -57,6 +76,11 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool is_modified() const;
   size_t write(JfrChunkWriter& cw, bool clear);
   size_t clear();
+  void clear_table();
+  void grow_if_needed();
+
+  static void entry_added();
+  static void entry_removed();
 
   const JfrStackTrace* lookup(unsigned int hash, traceid id) const;
 
@@ -67,6 +91,11 @@ class JfrStackTraceRepository : public JfrCHeapObj {
  public:
   static traceid record(Thread* thread, int skip = 0);
   static void record_and_cache(JavaThread* thread, int skip = 0);
+
+  // Number of recorded stack traces that were already in the repository,
+  // respectively that had to be added to it.
+  static size_t hits();
+  static size_t misses();
 };
 
 #endif // SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACEREPOSITORY_HPP
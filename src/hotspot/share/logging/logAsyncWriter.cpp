@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileStreamOutput.hpp"
+#include "logging/logTagSet.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.inline.hpp"
+
+AsyncLogWriter* AsyncLogWriter::_instance = NULL;
+
+AsyncLogMessage::AsyncLogMessage(LogFileStreamOutput& output, const LogDecorations& decorations, char* msg)
+  : _next(NULL), _output(output), _decorations(decorations), _message(msg),
+    _size(sizeof(AsyncLogMessage) + strlen(msg) + 1) {}
+
+AsyncLogMessage::~AsyncLogMessage() {
+  os::free(_message);
+}
+
+class AsyncLogLocker : public StackObj {
+ private:
+  Semaphore& _sem;
+ public:
+  AsyncLogLocker(Semaphore& sem) : _sem(sem) { _sem.wait(); }
+  ~AsyncLogLocker() { _sem.signal(); }
+};
+
+AsyncLogWriter::AsyncLogWriter()
+  : _lock(1), _sem(0), _io_sem(1),
+    _initialized(false),
+    _head(NULL), _tail(NULL), _buffer_size(0),
+    _buffer_max_size(AsyncLogBufferSize) {
+  if (os::create_thread(this, os::asynclog_thread)) {
+    _initialized = true;
+  } else {
+    log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
+  }
+}
+
+void AsyncLogWriter::account_dropped_locked(LogFileStreamOutput* output, uint32_t n) {
+  bool created;
+  uint32_t* counter = _dropped.put_if_absent(output, 0, &created);
+  *counter = *counter + n;
+}
+
+void AsyncLogWriter::enqueue_locked(AsyncLogMessage* msg) {
+  if (_buffer_size + msg->size() > _buffer_max_size) {
+    account_dropped_locked(&msg->output(), 1);
+    delete msg;
+    return;
+  }
+
+  if (_tail == NULL) {
+    _head = msg;
+  } else {
+    _tail->_next = msg;
+  }
+  _tail = msg;
+  _buffer_size += msg->size();
+}
+
+void AsyncLogWriter::enqueue(AsyncLogMessage* msg) {
+  {
+    AsyncLogLocker locker(_lock);
+    enqueue_locked(msg);
+  }
+  _sem.signal();
+}
+
+void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
+  // Copy the message outside of the critical section.
+  char* copy = os::strdup(msg, mtLogging);
+  if (copy == NULL) {
+    return;
+  }
+  enqueue(new AsyncLogMessage(output, decorations, copy));
+}
+
+// LogMessageBuffer consists of a multiple-part/multiple-line message.
+// The lines are enqueued as one group: either all of them fit into the
+// buffer and are written back to back, or the whole group is dropped.
+void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator) {
+  AsyncLogMessage* first = NULL;
+  AsyncLogMessage* last = NULL;
+  size_t group_size = 0;
+  uint32_t group_count = 0;
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    char* copy = os::strdup(msg_iterator.message(), mtLogging);
+    if (copy == NULL) {
+      continue;
+    }
+    AsyncLogMessage* m = new AsyncLogMessage(output, msg_iterator.decorations(), copy);
+    if (last == NULL) {
+      first = m;
+    } else {
+      last->_next = m;
+    }
+    last = m;
+    group_size += m->size();
+    group_count++;
+  }
+
+  if (first == NULL) {
+    return;
+  }
+
+  bool accepted;
+  {
+    AsyncLogLocker locker(_lock);
+    accepted = _buffer_size + group_size <= _buffer_max_size;
+    if (accepted) {
+      if (_tail == NULL) {
+        _head = first;
+      } else {
+        _tail->_next = first;
+      }
+      _tail = last;
+      _buffer_size += group_size;
+    } else {
+      account_dropped_locked(&output, group_count);
+    }
+  }
+
+  if (accepted) {
+    _sem.signal();
+  } else {
+    // Free the dropped group outside of the critical section.
+    while (first != NULL) {
+      AsyncLogMessage* next = first->_next;
+      delete first;
+      first = next;
+    }
+  }
+}
+
+// Turns the drop statistics into meta-messages appended to the batch about
+// to be written, so that each output learns how many of its messages were lost.
+class AsyncLogDropReporter : public StackObj {
+ private:
+  AsyncLogMessage** _tail;
+  LogFileStreamOutput* _outputs[17];
+  uint _num_outputs;
+
+ public:
+  AsyncLogDropReporter(AsyncLogMessage** tail) : _tail(tail), _num_outputs(0) {}
+
+  bool do_entry(LogFileStreamOutput* const& output, uint32_t const& counter) {
+    typedef LogTagSetMapping<LogTag::__NO_TAG> none;
+
+    if (counter > 0) {
+      LogDecorations decorations(LogLevel::Warning, none::tagset(), output->decorators());
+      const int sz = 128;
+      char* msg = NEW_C_HEAP_ARRAY(char, sz, mtLogging);
+      jio_snprintf(msg, sz, UINT32_FORMAT_W(6) " messages dropped due to async logging", counter);
+
+      AsyncLogMessage* m = new AsyncLogMessage(*output, decorations, msg);
+      *_tail = m;
+      _tail = &m->_next;
+    }
+
+    // The table is small; stop collecting if it somehow grew beyond what we
+    // can remember and pick up the remainder on the next round.
+    _outputs[_num_outputs++] = output;
+    return _num_outputs < ARRAY_SIZE(_outputs);
+  }
+
+  uint num_outputs() const { return _num_outputs; }
+  LogFileStreamOutput* output_at(uint i) const { return _outputs[i]; }
+};
+
+void AsyncLogWriter::write() {
+  // Only one thread drains at a time, so that batches are written in the
+  // order they were taken from the buffer.
+  AsyncLogLocker io_locker(_io_sem);
+
+  AsyncLogMessage* batch = NULL;
+  {
+    AsyncLogLocker locker(_lock);
+
+    // Take the whole buffer in O(1). The I/O below runs without holding
+    // _lock, so logsites are never blocked by the file system.
+    batch = _head;
+    _head = _tail = NULL;
+    _buffer_size = 0;
+
+    AsyncLogMessage** tail = &batch;
+    while (*tail != NULL) {
+      tail = &(*tail)->_next;
+    }
+
+    AsyncLogDropReporter reporter(tail);
+    _dropped.iterate(&reporter);
+    for (uint i = 0; i < reporter.num_outputs(); i++) {
+      _dropped.remove(reporter.output_at(i));
+    }
+  }
+
+  while (batch != NULL) {
+    AsyncLogMessage* next = batch->_next;
+    batch->output().write_blocking(batch->decorations(), batch->message());
+    delete batch;
+    batch = next;
+  }
+}
+
+void AsyncLogWriter::run() {
+  log_debug(logging, thread)("starting AsyncLog Thread tid = " INTX_FORMAT, os::current_thread_id());
+  while (true) {
+    // The semaphore counts enqueue operations. The thread sleeps while there
+    // is nothing to do; a single write() drains everything enqueued so far,
+    // so any surplus wakeups simply find an empty buffer.
+    _sem.wait();
+    write();
+  }
+}
+
+AsyncLogWriter* AsyncLogWriter::instance() {
+  return Atomic::load_acquire(&_instance);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!LogConfiguration::is_async_mode()) return;
+
+  assert(_instance == NULL, "initialize() should only be invoked once.");
+
+  AsyncLogWriter* self = new AsyncLogWriter();
+  if (self->_initialized) {
+    os::start_thread(self);
+    // Logsites that observe a non-NULL instance enqueue their messages from now on.
+    Atomic::release_store_fence(&AsyncLogWriter::_instance, self);
+    log_debug(logging, thread)("Async logging thread started.");
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = instance();
+  if (writer != NULL) {
+    writer->write();
+  }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/resourceHash.hpp"
+
+class LogFileStreamOutput;
+
+// A log message captured at the logsite. The decorations are computed by the
+// thread doing the logging, so that uptime, tid etc. reflect the logsite rather
+// than the time the message is eventually written.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+  friend class AsyncLogWriter;
+ private:
+  AsyncLogMessage*      _next;
+  LogFileStreamOutput&  _output;
+  const LogDecorations  _decorations;
+  char*                 _message;
+  size_t                _size;
+
+ public:
+  AsyncLogMessage(LogFileStreamOutput& output, const LogDecorations& decorations, char* msg);
+  ~AsyncLogMessage();
+
+  LogFileStreamOutput& output() const       { return _output; }
+  const LogDecorations& decorations() const { return _decorations; }
+  const char* message() const               { return _message; }
+
+  // Number of bytes this message accounts for in the bounded buffer.
+  size_t size() const                       { return _size; }
+};
+
+typedef ResourceHashtable<LogFileStreamOutput*,
+                          uint32_t,
+                          primitive_hash<LogFileStreamOutput*>,
+                          primitive_equals<LogFileStreamOutput*>,
+                          17, /*table_size*/
+                          ResourceObj::C_HEAP,
+                          mtLogging> AsyncLogDropMap;
+
+// Asynchronous logging.
+//
+// With -Xlog:async, logsites do not perform any I/O. Instead, the message and
+// its decorations are copied into a bounded FIFO buffer of at most
+// AsyncLogBufferSize bytes and the single "AsyncLog Thread" writes them to
+// their outputs. Logsites only hold a short critical section to append to
+// the buffer; they never block on the file system.
+//
+// If the buffer is full, the message is dropped and accounted against its
+// output. The next time the writer runs it emits a warning to every affected
+// output telling how many messages were lost.
+//
+// flush() can be called by any thread to synchronously drain the buffer,
+// e.g. before an output is deleted or when the VM exits.
+class AsyncLogWriter : public NonJavaThread {
+ private:
+  static AsyncLogWriter* _instance;
+
+  // Critical section protecting the buffer and the drop statistics.
+  Semaphore _lock;
+  // Number of pending wakeups of the writer thread.
+  Semaphore _sem;
+  // Serializes draining of the buffer between the writer thread and flush().
+  Semaphore _io_sem;
+
+  volatile bool _initialized;
+
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+  size_t           _buffer_size;
+  const size_t     _buffer_max_size;
+
+  AsyncLogDropMap  _dropped;
+
+  AsyncLogWriter();
+
+  void account_dropped_locked(LogFileStreamOutput* output, uint32_t n);
+  void enqueue_locked(AsyncLogMessage* msg);
+  void enqueue(AsyncLogMessage* msg);
+  void write();
+
+  virtual void run();
+  virtual char* name() const { return (char*)"AsyncLog Thread"; }
+  virtual void print_on(outputStream* st) const {
+    st->print("\"%s\" ", name());
+    Thread::print_on(st);
+    st->cr();
+  }
+
+ public:
+  void enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg);
+  void enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator);
+
+  // Returns the writer if async logging is active, NULL otherwise.
+  static AsyncLogWriter* instance();
+
+  // Creates and starts the writer thread if -Xlog:async was given.
+  static void initialize();
+
+  // Writes out all messages enqueued so far before returning.
+  static void flush();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
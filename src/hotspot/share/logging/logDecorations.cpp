@@ -37,6 +37,18 @@ LogDecorations::LogDecorations(LogLevelType level, const LogTagSet &tagset, cons
   create_decorations(decorators);
 }
 
+LogDecorations::LogDecorations(const LogDecorations& other)
+    : _level(other._level), _tagset(other._tagset) {
+  memcpy(_decorations_buffer, other._decorations_buffer, DecorationsBufferSize);
+  for (size_t i = 0; i < LogDecorators::Count; i++) {
+    if (other._decoration_offset[i] == NULL) {
+      _decoration_offset[i] = NULL;
+    } else {
+      _decoration_offset[i] = _decorations_buffer + (other._decoration_offset[i] - other._decorations_buffer);
+    }
+  }
+}
+
 const char* LogDecorations::host_name() {
   const char* host_name = Atomic::load_acquire(&_host_name);
   if (host_name == NULL) {
@@ -70,14 +82,46 @@ void LogDecorations::create_decorations(const LogDecorators &decorators) {
     assert(written >= 0, "Decorations buffer overflow"); \
     return pos + written;
 
+#ifndef USE_LIBRARY_BASED_TLS_ONLY
+// Formatting a time decoration needs a localtime or gmtime conversion, but
+// within one second only the milliseconds change. Each thread keeps the
+// last stamp it formatted, for local time and UTC, and only rewrites the
+// milliseconds while the second is unchanged.
+static THREAD_LOCAL jlong _last_time_seconds[2] = { -1, -1 };
+static THREAD_LOCAL char  _last_time_stamp[2][29];
+#endif
+
+static char* cached_iso8601_time(char* pos, bool utc) {
+#ifndef USE_LIBRARY_BASED_TLS_ONLY
+  const int kind = utc ? 1 : 0;
+  const jlong millis = os::javaTimeMillis();
+  const jlong seconds = millis / 1000;
+  if (seconds != _last_time_seconds[kind]) {
+    if (os::iso8601_time(millis, _last_time_stamp[kind], sizeof(_last_time_stamp[kind]), utc) == NULL) {
+      return NULL;
+    }
+    _last_time_seconds[kind] = seconds;
+  }
+  memcpy(pos, _last_time_stamp[kind], sizeof(_last_time_stamp[kind]));
+  // The milliseconds are at "YYYY-MM-DDThh:mm:ss.###+zzzz".
+  const int ms = (int)(millis % 1000);
+  pos[20] = '0' + ms / 100;
+  pos[21] = '0' + (ms / 10) % 10;
+  pos[22] = '0' + ms % 10;
+  return pos;
+#else
+  return os::iso8601_time(pos, 29, utc);
+#endif
+}
+
 char* LogDecorations::create_time_decoration(char* pos) {
-  char* buf = os::iso8601_time(pos, 29);
+  char* buf = cached_iso8601_time(pos, false);
   int written = buf == NULL ? -1 : 29;
   ASSERT_AND_RETURN(written, pos)
 }
 
 char* LogDecorations::create_utctime_decoration(char* pos) {
-  char* buf = os::iso8601_time(pos, 29, true);
+  char* buf = cached_iso8601_time(pos, true);
   int written = buf == NULL ? -1 : 29;
   ASSERT_AND_RETURN(written, pos)
 }
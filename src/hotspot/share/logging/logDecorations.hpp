@@ -48,6 +48,10 @@ class LogDecorations {
  public:
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
 
+  // Copying rebases the decoration offsets onto the new buffer, so that a copy
+  // can outlive the original (used for asynchronous logging).
+  LogDecorations(const LogDecorations& other);
+
   void set_level(LogLevelType level) {
     _level = level;
   }
@@ -55,6 +55,9 @@ class LogFileStreamOutput : public LogOutput {
  public:
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
+  // Write the message to the stream on the calling thread.
+  // This is the only write path used by the AsyncLog Thread.
+  virtual int write_blocking(const LogDecorations& decorations, const char* msg);
 };
 
 class LogStdoutOutput : public LogFileStreamOutput {
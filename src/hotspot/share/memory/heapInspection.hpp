@@ -115,6 +115,8 @@ class KlassInfoTable: public StackObj {
 
   class AllClassesFinder;
 
+  bool merge_entry(const KlassInfoEntry* cie);
+
  public:
   KlassInfoTable(bool add_all_classes);
   ~KlassInfoTable();
@@ -122,6 +124,11 @@ class KlassInfoTable: public StackObj {
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
+  // Adds the counts of all entries of table to this table. Returns the
+  // number of instances that could not be recorded.
+  size_t merge(KlassInfoTable* table);
+
+  friend class KlassInfoTableMergeClosure;
 
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
@@ -211,8 +218,11 @@ class KlassInfoClosure;
 
 class HeapInspection : public StackObj {
  public:
-  void heap_inspection(outputStream* st) NOT_SERVICES_RETURN;
-  size_t populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL) NOT_SERVICES_RETURN_(0);
+  // With parallel_thread_num > 1 the heap is walked by that many GC
+  // workers if the collector supports a parallel heap walk.
+  void heap_inspection(outputStream* st, uint parallel_thread_num = 1) NOT_SERVICES_RETURN;
+  size_t populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL,
+                        uint parallel_thread_num = 1) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
  private:
   void iterate_over_heap(KlassInfoTable* cit, BoolObjectClosure* filter = NULL);
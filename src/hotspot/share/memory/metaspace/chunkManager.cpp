@@ -35,6 +35,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -529,6 +531,23 @@ Metachunk* ChunkManager::chunk_freelist_allocate(size_t word_size) {
   return chunk;
 }
 
+void ChunkManager::release_chunk_payload(Metachunk* chunk) {
+  // Large pages cannot be released piecemeal.
+  if (UseLargePages && UseLargePagesInMetaspace) {
+    return;
+  }
+  // Keep the page holding the chunk header and, for humongous chunks,
+  // the tree node the dictionary builds in place.
+  const size_t header_bytes = sizeof(TreeChunk<Metachunk, FreeList<Metachunk> >);
+  char* const start = align_up((char*)chunk + header_bytes, os::vm_page_size());
+  char* const end = align_down((char*)(chunk->bottom() + chunk->word_size()), os::vm_page_size());
+  if (start < end) {
+    os::free_memory(start, pointer_delta(end, start, sizeof(char)), os::vm_page_size());
+    log_trace(gc, metaspace, freelist)("released " SIZE_FORMAT " bytes of free chunk at " PTR_FORMAT " to the OS.",
+        pointer_delta(end, start, sizeof(char)), p2i(chunk));
+  }
+}
+
 void ChunkManager::return_single_chunk(Metachunk* chunk) {
 
 #ifdef ASSERT
@@ -551,6 +570,13 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
   // keeps tree node pointers in the chunk payload area which mangle will overwrite.
   DEBUG_ONLY(chunk->mangle(badMetaWordVal);)
 
+  // Chunks are returned when their class loader is unloaded. Medium and
+  // humongous chunks span many pages that would otherwise stay resident
+  // until the chunk gets reused, so give those pages back right away.
+  if (index == MediumIndex || index == HumongousIndex) {
+    release_chunk_payload(chunk);
+  }
+
   // may need node for verification later after chunk may have been merged away.
   DEBUG_ONLY(VirtualSpaceNode* vsn = chunk->container(); )
 
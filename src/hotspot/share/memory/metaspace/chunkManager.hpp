@@ -75,6 +75,10 @@ class ChunkManager : public CHeapObj<mtInternal> {
   void account_for_added_chunk(const Metachunk* c);
   void account_for_removed_chunk(const Metachunk* c);
 
+  // Gives the pages of a free chunk beyond its header back to the OS.
+  // The memory stays committed and is faulted in again on reuse.
+  void release_chunk_payload(Metachunk* chunk);
+
   // Given a pointer to a chunk, attempts to merge it with neighboring
   // free chunks to form a bigger chunk. Returns true if successful.
   bool attempt_to_coalesce_around_chunk(Metachunk* chunk, ChunkIndex target_chunk_type);
@@ -1862,27 +1862,45 @@ class LinkSharedClassesClosure : public KlassClosure {
         // to -Xverify setting.
         _made_progress |= MetaspaceShared::try_link_class(ik, THREAD);
         guarantee(!HAS_PENDING_EXCEPTION, "exception in link_class");
-
-        if (DumpSharedSpaces) {
-          // The following function is used to resolve all Strings in the statically
-          // dumped classes to archive all the Strings. The archive heap is not supported
-          // for the dynamic archive.
-          ik->constants()->resolve_class_constants(THREAD);
-        }
       }
     }
   }
 };
 
+// Resolves all Strings in the statically dumped classes to archive all the
+// Strings. The archive heap is not supported for the dynamic archive.
+class ResolveSharedClassConstantsClosure : public KlassClosure {
+  Thread* THREAD;
+ public:
+  ResolveSharedClassConstantsClosure(Thread* thread) : THREAD(thread) {}
+
+  void do_klass(Klass* k) {
+    if (k->is_instance_klass()) {
+      InstanceKlass::cast(k)->constants()->resolve_class_constants(THREAD);
+      guarantee(!HAS_PENDING_EXCEPTION, "exception in resolve_class_constants");
+    }
+  }
+};
+
 void MetaspaceShared::link_and_cleanup_shared_classes(TRAPS) {
   // We need to iterate because verification may cause additional classes
   // to be loaded.
   LinkSharedClassesClosure link_closure(THREAD);
+  int passes = 0;
   do {
     link_closure.reset();
     ClassLoaderDataGraph::unlocked_loaded_classes_do(&link_closure);
     guarantee(!HAS_PENDING_EXCEPTION, "exception in link_class");
+    passes++;
   } while (link_closure.made_progress());
+  log_debug(cds)("Linked shared classes in %d passes", passes);
+
+  if (DumpSharedSpaces) {
+    // Resolving the Strings does not load or link any classes, so it is
+    // done once after linking has converged rather than on every pass.
+    ResolveSharedClassConstantsClosure resolve_closure(THREAD);
+    ClassLoaderDataGraph::unlocked_loaded_classes_do(&resolve_closure);
+  }
 }
 
 void MetaspaceShared::prepare_for_dumping() {
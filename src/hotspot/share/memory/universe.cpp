@@ -656,14 +656,21 @@ jint universe_init() {
 
   GCConfig::arguments()->initialize_heap_sizes();
 
-  jint status = Universe::initialize_heap();
+  jint status;
+  {
+    TraceTime timer("Initialize heap", TRACETIME_LOG(Info, startuptime));
+    status = Universe::initialize_heap();
+  }
   if (status != JNI_OK) {
     return status;
   }
 
   Universe::initialize_tlab();
 
-  Metaspace::global_initialize();
+  {
+    TraceTime timer("Initialize metaspace", TRACETIME_LOG(Info, startuptime));
+    Metaspace::global_initialize();
+  }
 
   // Initialize performance counters for metaspaces
   MetaspaceCounters::initialize_performance_counters();
@@ -695,6 +702,7 @@ jint universe_init() {
     // the file (other than the mapped regions) is no longer needed, and
     // the file is closed. Closing the file does not affect the
     // currently mapped regions.
+    TraceTime timer("Initialize shared spaces", TRACETIME_LOG(Info, startuptime));
     MetaspaceShared::initialize_shared_spaces();
     StringTable::create_table();
   } else
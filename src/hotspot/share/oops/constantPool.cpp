@@ -29,6 +29,7 @@
 #include "classfile/metadataOnStackMark.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "interpreter/bootstrapInfo.hpp"
 #include "interpreter/linkResolver.hpp"
@@ -374,6 +375,30 @@ void ConstantPool::restore_unshareable_info(TRAPS) {
   }
 }
 
+#if INCLUDE_CDS
+// Returns true if the resolved class entry at cp_index is guaranteed to
+// resolve to the same class at runtime, so it does not need to be cleared.
+bool ConstantPool::is_class_resolution_deterministic(int cp_index) {
+  assert(tag_at(cp_index).is_klass(), "must be resolved");
+  if (!ArchiveResolvedSuperClasses) {
+    return false;
+  }
+  InstanceKlass* holder = pool_holder();
+  if (!SystemDictionaryShared::is_builtin(holder)) {
+    return false;
+  }
+  CPKlassSlot kslot = klass_slot_at(cp_index);
+  Klass* k = resolved_klasses()->at(kslot.resolved_klass_index());
+  if (k == NULL || !k->is_instance_klass()) {
+    return false;
+  }
+  // All supertypes of the holder are resolved in the holder's loader before
+  // the holder is defined. An archived class is only used at runtime if its
+  // supertypes are the same archived classes, so the entry stays valid.
+  return holder->is_subtype_of(k);
+}
+#endif // INCLUDE_CDS
+
 void ConstantPool::remove_unshareable_info() {
   // Resolved references are not in the shared archive.
   // Save the length for restoration.  It is not necessarily the same length
@@ -419,6 +444,8 @@ void ConstantPool::remove_unshareable_info() {
         // All references to a hidden class's own field/methods are through this
         // index. We cannot clear it. See comments in ClassFileParser::fill_instance_klass.
         clear_it = false;
+      } else if (is_class_resolution_deterministic(index)) {
+        clear_it = false;
       }
       if (clear_it) {
         CPKlassSlot kslot = klass_slot_at(index);
@@ -3002,20 +3002,45 @@ HOTSPOT_JNI_RELEASEPRIMITIVEARRAYCRITICAL_RETURN();
 JNI_END
 
 
+static typeArrayOop lock_gc_or_pin_string_value(JavaThread* thread, jstring str) {
+  if (Universe::heap()->supports_object_pinning()) {
+    // Native code only accesses the value array, so pin that instead
+    // of the string itself.
+    typeArrayOop s_value = java_lang_String::value(JNIHandles::resolve_non_null(str));
+    return (typeArrayOop) Universe::heap()->pin_object(thread, s_value);
+  } else {
+    GCLocker::lock_critical(thread);
+    return java_lang_String::value(JNIHandles::resolve_non_null(str));
+  }
+}
+
+static void unlock_gc_or_unpin_string_value(JavaThread* thread, const jchar* chars) {
+  if (Universe::heap()->supports_object_pinning()) {
+    // The string may have been deduplicated in the meantime, so find the
+    // pinned value array from the characters handed out to native code.
+    typeArrayOop s_value = (typeArrayOop) cast_to_oop((address) chars - arrayOopDesc::base_offset_in_bytes(T_CHAR));
+    Universe::heap()->unpin_object(thread, s_value);
+  } else {
+    GCLocker::unlock_critical(thread);
+  }
+}
+
 JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jboolean *isCopy))
   JNIWrapper("GetStringCritical");
   HOTSPOT_JNI_GETSTRINGCRITICAL_ENTRY(env, string, (uintptr_t *) isCopy);
-  oop s = lock_gc_or_pin_object(thread, string);
-  typeArrayOop s_value = java_lang_String::value(s);
+  oop s = JNIHandles::resolve_non_null(string);
   bool is_latin1 = java_lang_String::is_latin1(s);
   if (isCopy != NULL) {
     *isCopy = is_latin1 ? JNI_TRUE : JNI_FALSE;
   }
   jchar* ret;
   if (!is_latin1) {
+    typeArrayOop s_value = lock_gc_or_pin_string_value(thread, string);
     ret = (jchar*) s_value->base(T_CHAR);
   } else {
-    // Inflate latin1 encoded string to UTF16
+    // Inflate latin1 encoded string to UTF16. The copy is made without
+    // reaching a safepoint, so the value array need not be protected.
+    typeArrayOop s_value = java_lang_String::value(s);
     int s_len = java_lang_String::length(s, s_value);
     ret = NEW_C_HEAP_ARRAY_RETURN_NULL(jchar, s_len + 1, mtInternal);  // add one for zero termination
     /* JNI Specification states return NULL on OOM */
@@ -3034,15 +3059,16 @@ JNI_END
 JNI_ENTRY(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar *chars))
   JNIWrapper("ReleaseStringCritical");
   HOTSPOT_JNI_RELEASESTRINGCRITICAL_ENTRY(env, str, (uint16_t *) chars);
-  // The str and chars arguments are ignored for UTF16 strings
   oop s = JNIHandles::resolve_non_null(str);
   bool is_latin1 = java_lang_String::is_latin1(s);
   if (is_latin1) {
     // For latin1 string, free jchar array allocated by earlier call to GetStringCritical.
     // This assumes that ReleaseStringCritical bookends GetStringCritical.
     FREE_C_HEAP_ARRAY(jchar, chars);
+  } else {
+    // For UTF16 string, the chars point into the value array protected by GetStringCritical.
+    unlock_gc_or_unpin_string_value(thread, chars);
   }
-  unlock_gc_or_unpin_object(thread, str);
 HOTSPOT_JNI_RELEASESTRINGCRITICAL_RETURN();
 JNI_END
 
@@ -363,7 +363,11 @@ static HeuristicsResult update_heuristics(oop o) {
 }
 
 
-void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread* requesting_thread) {
+// If walked_threads and locking_threads are not NULL, they are set to the number
+// of threads whose stacks were walked and to the number of those threads that
+// held biased locks on instances of the class, respectively.
+void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread* requesting_thread,
+                                             uint* walked_threads, uint* locking_threads) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be done at safepoint");
   assert(Thread::current()->is_VM_thread(), "must be VMThread");
 
@@ -380,6 +384,9 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
   Klass* k_o = o->klass();
   Klass* klass = k_o;
 
+  uint num_walked_threads = 0;
+  uint num_locking_threads = 0;
+
   {
     JavaThreadIteratorWithHandle jtiwh;
 
@@ -402,6 +409,7 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
         // Now walk all threads' stacks and adjust epochs of any biased
         // and locked objects of this data type we encounter
         for (; JavaThread *thr = jtiwh.next(); ) {
+          bool holds_biased_lock = false;
           GrowableArray<MonitorInfo*>* cached_monitor_info = get_or_compute_monitor_info(thr);
           for (int i = 0; i < cached_monitor_info->length(); i++) {
             MonitorInfo* mon_info = cached_monitor_info->at(i);
@@ -411,8 +419,13 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
               // We might have encountered this object already in the case of recursive locking
               assert(mark.bias_epoch() == prev_epoch || mark.bias_epoch() == cur_epoch, "error in bias epoch adjustment");
               owner->set_mark(mark.set_bias_epoch(cur_epoch));
+              holds_biased_lock = true;
             }
           }
+          num_walked_threads++;
+          if (holds_biased_lock) {
+            num_locking_threads++;
+          }
         }
       }
 
@@ -434,6 +447,7 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
       // Now walk all threads' stacks and forcibly revoke the biases of
       // any locked and biased objects of this data type we encounter.
       for (; JavaThread *thr = jtiwh.next(); ) {
+        bool holds_biased_lock = false;
         GrowableArray<MonitorInfo*>* cached_monitor_info = get_or_compute_monitor_info(thr);
         for (int i = 0; i < cached_monitor_info->length(); i++) {
           MonitorInfo* mon_info = cached_monitor_info->at(i);
@@ -441,8 +455,13 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
           markWord mark = owner->mark();
           if ((owner->klass() == k_o) && mark.has_bias_pattern()) {
             single_revoke_at_safepoint(owner, true, requesting_thread, NULL);
+            holds_biased_lock = true;
           }
         }
+        num_walked_threads++;
+        if (holds_biased_lock) {
+          num_locking_threads++;
+        }
       }
 
       // Must force the bias of the passed object to be forcibly revoked
@@ -451,7 +470,15 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
     }
   } // ThreadsListHandle is destroyed here.
 
-  log_info(biasedlocking)("* Ending bulk revocation");
+  log_info(biasedlocking)("* Ending bulk revocation, walked %u threads, %u held biased locks",
+                          num_walked_threads, num_locking_threads);
+
+  if (walked_threads != NULL) {
+    *walked_threads = num_walked_threads;
+  }
+  if (locking_threads != NULL) {
+    *locking_threads = num_locking_threads;
+  }
 
   assert(!o->mark().has_bias_pattern(), "bug in bulk bias revocation");
 }
@@ -475,6 +502,8 @@ private:
   JavaThread* _requesting_thread;
   bool _bulk_rebias;
   uint64_t _safepoint_id;
+  uint _walked_threads;
+  uint _locking_threads;
 
 public:
   VM_BulkRevokeBias(Handle* obj, JavaThread* requesting_thread,
@@ -482,12 +511,15 @@ public:
     : _obj(obj)
     , _requesting_thread(requesting_thread)
     , _bulk_rebias(bulk_rebias)
-    , _safepoint_id(0) {}
+    , _safepoint_id(0)
+    , _walked_threads(0)
+    , _locking_threads(0) {}
 
   virtual VMOp_Type type() const { return VMOp_BulkRevokeBias; }
 
   virtual void doit() {
-    BiasedLocking::bulk_revoke_at_safepoint((*_obj)(), _bulk_rebias, _requesting_thread);
+    BiasedLocking::bulk_revoke_at_safepoint((*_obj)(), _bulk_rebias, _requesting_thread,
+                                            &_walked_threads, &_locking_threads);
     _safepoint_id = SafepointSynchronize::safepoint_id();
     clean_up_cached_monitor_info();
   }
@@ -499,6 +531,14 @@ public:
   uint64_t safepoint_id() const {
     return _safepoint_id;
   }
+
+  uint walked_threads() const {
+    return _walked_threads;
+  }
+
+  uint locking_threads() const {
+    return _locking_threads;
+  }
 };
 
 
@@ -607,6 +647,8 @@ static void post_class_revocation_event(EventBiasedLockClassRevocation* event, K
   event->set_revokedClass(k);
   event->set_disableBiasing(!op->is_bulk_rebias());
   event->set_safepointId(op->safepoint_id());
+  event->set_walkedThreads(op->walked_threads());
+  event->set_lockingThreads(op->locking_threads());
   event->commit();
 }
 
@@ -230,7 +230,8 @@ public:
 
 private:
   static void single_revoke_at_safepoint(oop obj, bool is_bulk, JavaThread* requester, JavaThread** biaser);
-  static void bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread* requester);
+  static void bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread* requester,
+                                       uint* walked_threads = NULL, uint* locking_threads = NULL);
   static Condition single_revoke_with_handshake(Handle obj, JavaThread *requester, JavaThread *biaser);
   static void walk_stack_and_revoke(oop obj, JavaThread* biased_locker);
 
@@ -693,6 +693,11 @@ const size_t minimumSymbolTableSize = 1024;
           "MonitorUsedDeflationThreshold is exceeded (0 is off).")          \
           range(0, max_jint)                                                \
                                                                             \
+  diagnostic(intx, AsyncDeflationBatchSize, 0,                              \
+          "Maximum number of monitors on the global in-use list that are "  \
+          "examined before async deflation yields the CPU (0 is no limit)") \
+          range(0, max_jint)                                                \
+                                                                            \
   experimental(intx, MonitorUsedDeflationThreshold, 90,                     \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -874,6 +879,12 @@ const size_t minimumSymbolTableSize = 1024;
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
+  product(size_t, InlineCacheBufferSize, 10*K,                              \
+          "Size in bytes of the buffer for inline cache transition stubs. " \
+          "When it is full, a safepoint is needed to apply the pending "    \
+          "transitions")                                                    \
+          range(1*K, 1*M)                                                   \
+                                                                            \
   develop(bool, FLSVerifyDictionary, false,                                 \
           "Do lots of (expensive) FLS dictionary verification")             \
                                                                             \
@@ -1126,6 +1137,11 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, ErrorFileToStdout, false,                                   \
           "If true, error data is printed to stdout instead of a file")     \
                                                                             \
+  product(size_t, AsyncLogBufferSize, 2*M,                                  \
+          "Memory budget (in bytes) for the buffer of Asynchronous "        \
+          "Logging (-Xlog:async)")                                          \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(bool, UseHeavyMonitors, false,                                    \
           "use heavyweight instead of lightweight Java monitors")           \
                                                                             \
@@ -2373,6 +2389,10 @@ const size_t minimumSymbolTableSize = 1024;
            "do not map the archive")                                        \
            range(0, 2)                                                      \
                                                                             \
+  diagnostic(bool, ArchiveResolvedSuperClasses, false,                      \
+          "Keep constant pool class entries that were resolved at dump "    \
+          "time to a supertype of the pool holder in the CDS archive")      \
+                                                                            \
   experimental(size_t, ArrayAllocatorMallocLimit, (size_t)-1,               \
           "Allocation less than this value will be allocated "              \
           "using malloc. Larger allocations will use mmap.")                \
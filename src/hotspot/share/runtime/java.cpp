@@ -40,6 +40,7 @@
 #include "jvmci/jvmci.hpp"
 #endif
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logStream.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -499,6 +500,9 @@ void before_exit(JavaThread* thread) {
   print_statistics();
   Universe::heap()->print_tracing_info();
 
+  // Write out the asynchronous log messages pending at this point.
+  AsyncLogWriter::flush();
+
   { MutexLocker ml(BeforeExit_lock);
     _before_exit_status = BEFORE_EXIT_DONE;
     BeforeExit_lock->notify_all();
@@ -41,6 +41,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -65,6 +66,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe_hp.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -137,6 +139,8 @@ volatile uint64_t SafepointSynchronize::_safepoint_counter = 0;
 uint64_t SafepointSynchronize::_safepoint_id = 0;
 const uint64_t SafepointSynchronize::InactiveSafepointCounter = 0;
 int SafepointSynchronize::_current_jni_active_count = 0;
+JavaThread* SafepointSynchronize::_slow_thread = NULL;
+int SafepointSynchronize::_slow_thread_iterations = 0;
 
 WaitBarrier* SafepointSynchronize::_wait_barrier;
 
@@ -181,6 +185,79 @@ bool SafepointSynchronize::thread_not_running(ThreadSafepointState *cur_state) {
   return false;
 }
 
+static void post_safepoint_slow_thread_event(EventSafepointSlowThread& event,
+                                             uint64_t safepoint_id,
+                                             JavaThread* thread,
+                                             int iterations,
+                                             Method* method,
+                                             int bci,
+                                             uint compile_id) {
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_slowThread(JFR_THREAD_ID(thread));
+    event.set_iterations(iterations);
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_compileId(compile_id);
+    event.commit();
+  }
+}
+
+// Tells where the last thread to reach the safepoint was stopped. Threads
+// that keep running long after the safepoint has been armed usually sit in
+// a loop without safepoint polls, so the top Java frame of that thread is
+// the place to look at. All threads are stopped now, so its stack is stable.
+void SafepointSynchronize::report_slow_thread() {
+  JavaThread* thread = _slow_thread;
+  if (thread == NULL) {
+    // All threads were already safe on the first check.
+    return;
+  }
+
+  LogTarget(Info, safepoint, stats) lt;
+  EventSafepointSlowThread event;
+  if (!lt.is_enabled() && !event.should_commit()) {
+    return;
+  }
+
+  ResourceMark rm;
+  Method* method = NULL;
+  int bci = -1;
+  uint compile_id = 0;
+  if (thread->has_last_Java_frame()) {
+    RegisterMap reg_map(thread, false);
+    javaVFrame* jvf = thread->last_java_vframe(&reg_map);
+    if (jvf != NULL) {
+      method = jvf->method();
+      bci = jvf->bci();
+      if (jvf->is_compiled_frame()) {
+        CompiledMethod* cm = compiledVFrame::cast(jvf)->code();
+        if (cm != NULL) {
+          compile_id = (uint)cm->compile_id();
+        }
+      }
+    }
+  }
+
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Slow thread \"%s\" reached safepoint after %d iterations",
+             thread->get_thread_name(), _slow_thread_iterations);
+    if (method != NULL) {
+      ls.print(" in %s @ %d", method->name_and_sig_as_C_string(), bci);
+      if (compile_id != 0) {
+        ls.print(" (compile id %u)", compile_id);
+      } else {
+        ls.print(" (interpreted)");
+      }
+    }
+    ls.cr();
+  }
+
+  post_safepoint_slow_thread_event(event, _safepoint_id, thread,
+                                   _slow_thread_iterations, method, bci, compile_id);
+}
+
 #ifdef ASSERT
 static void assert_list_is_valid(const ThreadSafepointState* tss_head, int still_running) {
   int a = 0;
@@ -216,6 +293,9 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 #endif // ASSERT
 
   // Iterate through all threads until it has been determined how to stop them all at a safepoint.
+  _slow_thread = NULL;
+  _slow_thread_iterations = 0;
+
   int still_running = nof_threads;
   ThreadSafepointState *tss_head = NULL;
   ThreadSafepointState **p_prev = &tss_head;
@@ -256,6 +336,8 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        _slow_thread = cur_tss->thread();
+        _slow_thread_iterations = iterations;
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -416,6 +498,7 @@ void SafepointSynchronize::begin() {
                                    _waiting_to_block, iterations);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
+  report_slow_thread();
 
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
@@ -110,6 +110,11 @@ class SafepointSynchronize : AllStatic {
   static WaitBarrier* _wait_barrier;
   static julong       _coalesced_vmop_count;     // coalesced vmop count
 
+  // The thread that was the last to reach the current safepoint, and the
+  // number of state check iterations it took. Reported by safepoint+stats.
+  static JavaThread*  _slow_thread;
+  static int          _slow_thread_iterations;
+
   // For debug long safepoint
   static void print_safepoint_timeout();
 
@@ -120,6 +125,7 @@ class SafepointSynchronize : AllStatic {
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
   static bool thread_not_running(ThreadSafepointState *cur_state);
+  static void report_slow_thread();
 
   // Used in safepoint_safe to do a stable load of the thread state.
   static bool try_stable_load_state(JavaThreadState *state,
@@ -2324,7 +2324,9 @@ int ObjectSynchronizer::deflate_monitor_list(ObjectMonitor** list_p,
 // a JavaThread. Returns the number of deflated ObjectMonitors. The given
 // list could be a per-thread in-use list or the global in-use list.
 // If a safepoint has started, then we save state via saved_mid_in_use_p
-// and return to the caller to honor the safepoint.
+// and return to the caller to honor the safepoint. For the global in-use
+// list we also save state and return after AsyncDeflationBatchSize
+// ObjectMonitors have been examined, so the caller can yield.
 //
 int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
                                                       int* count_p,
@@ -2339,6 +2341,11 @@ int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
   ObjectMonitor* next = NULL;
   ObjectMonitor* next_next = NULL;
   int deflated_count = 0;
+  // Only the global in-use list is walked in batches. A per-thread list
+  // can be moved to the global list by om_flush() while we are not holding
+  // any locks on it, so the saved state would not stay valid.
+  const bool batched = AsyncDeflationBatchSize > 0 && list_p == &om_list_globals._in_use_list;
+  intx examined = 0;
   NoSafepointVerifier nsv;
 
   // We use the more complicated lock-cur_mid_in_use-and-mid-as-we-go
@@ -2436,14 +2443,15 @@ int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
       mid = next;  // mid keeps non-NULL next's locked state
       next = next_next;
 
-      if (SafepointMechanism::should_block(self) &&
+      if ((SafepointMechanism::should_block(self) ||
+           (batched && ++examined >= AsyncDeflationBatchSize)) &&
           // Acquire semantics are not needed on this list load since
           // it is not dependent on the following load which does have
           // acquire semantics.
           cur_mid_in_use != Atomic::load(list_p) && cur_mid_in_use->is_old()) {
-        // If a safepoint has started and cur_mid_in_use is not the list
-        // head and is old, then it is safe to use as saved state. Return
-        // to the caller before blocking.
+        // If a safepoint has started or the batch is done, and
+        // cur_mid_in_use is not the list head and is old, then it is safe
+        // to use as saved state. Return to the caller before blocking.
         *saved_mid_in_use_p = cur_mid_in_use;
         om_unlock(cur_mid_in_use);
         if (mid != NULL) {
@@ -2653,8 +2661,9 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
     OM_PERFDATA_OP(MonExtant, inc(Atomic::load(&target->om_in_use_count)));
   }
 
+  bool paused_for_safepoint = false;
   do {
-    if (saved_mid_in_use_p != NULL) {
+    if (paused_for_safepoint) {
       // We looped around because deflate_monitor_list_using_JT()
       // detected a pending safepoint. Honoring the safepoint is good,
       // but as long as is_special_deflation_requested() is supported,
@@ -2663,6 +2672,7 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
       // deflation and would no longer be on the in-use list where we
       // originally found it.
       saved_mid_in_use_p = NULL;
+      paused_for_safepoint = false;
     }
     int local_deflated_count;
     if (is_global) {
@@ -2700,8 +2710,18 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
       OM_PERFDATA_OP(Deflations, inc(local_deflated_count));
     }
 
-    if (saved_mid_in_use_p != NULL) {
+    if (saved_mid_in_use_p != NULL && !SafepointMechanism::should_block(self)) {
+      // deflate_monitor_list_using_JT() finished a batch of the global
+      // in-use list. No safepoint can have happened since we stayed in
+      // the VM, so the saved state is still valid; give other threads a
+      // chance to run and then resume where we left off.
+      assert(is_global, "only the global in-use list is walked in batches");
+      free_head_p = NULL;
+      free_tail_p = NULL;
+      os::naked_yield();
+    } else if (saved_mid_in_use_p != NULL) {
       // deflate_monitor_list_using_JT() detected a safepoint starting.
+      paused_for_safepoint = true;
       timer.stop();
       {
         if (is_global) {
@@ -507,10 +507,15 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
        "BOOLEAN", false, "false"),
   _gzip("-gz", "If specified, the heap dump is written in gzipped format "
                "using the given compression level. 1 (recommended) is the fastest, "
-               "9 the strongest compression.", "INT", false, "1") {
+               "9 the strongest compression.", "INT", false, "1"),
+  _parallel("-parallel", "Number of threads used to walk the heap. Values "
+                         "greater than 1 are only honored if the garbage "
+                         "collector supports a parallel heap walk.",
+            "INT", false, "1") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_argument(&_filename);
   _dcmdparser.add_dcmd_option(&_gzip);
+  _dcmdparser.add_dcmd_option(&_parallel);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
@@ -525,11 +530,17 @@ void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
     }
   }
 
+  jlong parallel = _parallel.value();
+  if (parallel < 1) {
+    output()->print_cr("Invalid number of parallel dump threads: " JLONG_FORMAT, parallel);
+    return;
+  }
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output(), (int) level);
+  dumper.dump(_filename.value(), output(), (int) level, (uint) MIN2(parallel, (jlong) max_juint));
 }
 
 int HeapDumpDCmd::num_arguments() {
@@ -546,13 +557,25 @@ int HeapDumpDCmd::num_arguments() {
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
   _all("-all", "Inspect all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _parallel("-parallel", "Number of threads used to walk the heap. Values "
+                         "greater than 1 are only honored if the garbage "
+                         "collector supports a parallel heap walk.",
+            "INT", false, "1") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_parallel);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  jlong parallel = _parallel.value();
+  if (parallel < 1) {
+    output()->print_cr("Invalid number of parallel heap inspection threads: " JLONG_FORMAT, parallel);
+    return;
+  }
+
   VM_GC_HeapInspection heapop(output(),
-                              !_all.value() /* request full gc if false */);
+                              !_all.value() /* request full gc if false */,
+                              (uint) MIN2(parallel, (jlong) max_juint));
   VMThread::execute(&heapop);
 }
 
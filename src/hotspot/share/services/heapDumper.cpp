@@ -41,10 +41,12 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/thread.inline.hpp"
@@ -380,9 +382,9 @@ enum {
 };
 
 // Supports I/O operations for a dump
-
-class DumpWriter : public StackObj {
- private:
+// Base class for dump and parallel dump
+class AbstractDumpWriter : public StackObj {
+ protected:
   enum {
     io_buffer_max_size = 1*M,
     io_buffer_max_waste = 10*K,
@@ -398,9 +400,7 @@ class DumpWriter : public StackObj {
   DEBUG_ONLY(size_t _sub_record_left;) // The bytes not written for the current sub-record.
   DEBUG_ONLY(bool _sub_record_ended;) // True if we have called the end_sub_record().
 
-  CompressionBackend _backend; // Does the actual writing.
-
-  void flush();
+  virtual void flush() = 0;
 
   char* buffer() const                          { return _buffer; }
   size_t buffer_size() const                    { return _size; }
@@ -414,15 +414,15 @@ class DumpWriter : public StackObj {
   bool can_write_fast(size_t len);
 
  public:
-  // Takes ownership of the writer and compressor.
-  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
-
-  ~DumpWriter();
+  AbstractDumpWriter() :
+    _buffer(NULL),
+    _size(io_buffer_max_size),
+    _pos(0),
+    _in_dump_segment(false) { }
 
   // total number of bytes written to the disk
-  julong bytes_written() const          { return (julong) _backend.get_written(); }
-
-  char const* error() const             { return _backend.error(); }
+  virtual julong bytes_written() const = 0;
+  virtual char const* error() const = 0;
 
   // writer functions
   void write_raw(void* s, size_t len);
@@ -442,6 +442,32 @@ class DumpWriter : public StackObj {
   // Finishes the current dump segment if not already finished.
   void finish_dump_segment();
 
+  // Returns true if a sub-record of the given length does not fit into a
+  // single full buffer together with the segment header.
+  static bool is_huge_sub_record(size_t len) {
+    return len > io_buffer_max_size - dump_segment_header_size;
+  }
+};
+
+// Supports writing the dump to a file, using the (possibly compressing) backend.
+class DumpWriter : public AbstractDumpWriter {
+ private:
+  CompressionBackend _backend; // Does the actual writing.
+
+ protected:
+  virtual void flush();
+
+ public:
+  // Takes ownership of the writer and compressor.
+  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
+
+  ~DumpWriter();
+
+  // total number of bytes written to the disk
+  virtual julong bytes_written() const  { return (julong) _backend.get_written(); }
+
+  virtual char const* error() const     { return _backend.error(); }
+
   // Called by threads used for parallel writing.
   void writer_loop()                    { _backend.thread_loop(false); }
   // Called when finished to release the threads.
@@ -450,10 +476,7 @@ class DumpWriter : public StackObj {
 
 // Check for error after constructing the object and destroy it in case of an error.
 DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
-  _buffer(NULL),
-  _size(0),
-  _pos(0),
-  _in_dump_segment(false),
+  AbstractDumpWriter(),
   _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
   flush();
 }
@@ -462,7 +485,57 @@ DumpWriter::~DumpWriter() {
   flush();
 }
 
-void DumpWriter::write_fast(void* s, size_t len) {
+// flush any buffered bytes to the file
+void DumpWriter::flush() {
+  _backend.get_new_buffer(&_buffer, &_pos, &_size);
+}
+
+// Used by the parallel heap dumpers. Each dumper serializes its part of the
+// heap into a private buffer. The buffer only ever holds complete
+// HPROF_HEAP_DUMP_SEGMENT records; when a segment is finished it is appended
+// to the global writer under a lock. Thus every segment is contiguous in the
+// dump file, while the segments of the different dumpers get interleaved.
+// Huge sub-records would have to be flushed in pieces and are therefore never
+// written through a ParDumpWriter, see HeapDumpLargeObjectList.
+class ParDumpWriter : public AbstractDumpWriter {
+ private:
+  DumpWriter* const _global;
+  Mutex* const      _lock;
+
+ protected:
+  virtual void flush();
+
+ public:
+  ParDumpWriter(DumpWriter* global, Mutex* lock);
+  ~ParDumpWriter();
+
+  virtual julong bytes_written() const  { return _global->bytes_written(); }
+  virtual char const* error() const     { return _global->error(); }
+};
+
+ParDumpWriter::ParDumpWriter(DumpWriter* global, Mutex* lock) :
+  AbstractDumpWriter(),
+  _global(global),
+  _lock(lock) {
+  _buffer = NEW_C_HEAP_ARRAY(char, io_buffer_max_size, mtInternal);
+}
+
+ParDumpWriter::~ParDumpWriter() {
+  finish_dump_segment();
+  flush();
+  FREE_C_HEAP_ARRAY(char, _buffer);
+}
+
+void ParDumpWriter::flush() {
+  assert(!_in_dump_segment || !_is_huge_sub_record, "huge sub-records must not be written in parallel");
+  if (position() > 0 && error() == NULL) {
+    MutexLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    _global->write_raw(buffer(), position());
+  }
+  set_position(0);
+}
+
+void AbstractDumpWriter::write_fast(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   assert(buffer_size() - position() >= len, "Must fit");
   debug_only(_sub_record_left -= len);
@@ -471,12 +544,12 @@ void DumpWriter::write_fast(void* s, size_t len) {
   set_position(position() + len);
 }
 
-bool DumpWriter::can_write_fast(size_t len) {
+bool AbstractDumpWriter::can_write_fast(size_t len) {
   return buffer_size() - position() >= len;
 }
 
 // write raw bytes
-void DumpWriter::write_raw(void* s, size_t len) {
+void AbstractDumpWriter::write_raw(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   debug_only(_sub_record_left -= len);
 
@@ -497,38 +570,33 @@ void DumpWriter::write_raw(void* s, size_t len) {
   set_position(position() + len);
 }
 
-// flush any buffered bytes to the file
-void DumpWriter::flush() {
-  _backend.get_new_buffer(&_buffer, &_pos, &_size);
-}
-
 // Makes sure we inline the fast write into the write_u* functions. This is a big speedup.
 #define WRITE_KNOWN_TYPE(p, len) do { if (can_write_fast((len))) write_fast((p), (len)); \
                                       else write_raw((p), (len)); } while (0)
 
-void DumpWriter::write_u1(u1 x) {
+void AbstractDumpWriter::write_u1(u1 x) {
   WRITE_KNOWN_TYPE((void*) &x, 1);
 }
 
-void DumpWriter::write_u2(u2 x) {
+void AbstractDumpWriter::write_u2(u2 x) {
   u2 v;
   Bytes::put_Java_u2((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 2);
 }
 
-void DumpWriter::write_u4(u4 x) {
+void AbstractDumpWriter::write_u4(u4 x) {
   u4 v;
   Bytes::put_Java_u4((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 4);
 }
 
-void DumpWriter::write_u8(u8 x) {
+void AbstractDumpWriter::write_u8(u8 x) {
   u8 v;
   Bytes::put_Java_u8((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 8);
 }
 
-void DumpWriter::write_objectID(oop o) {
+void AbstractDumpWriter::write_objectID(oop o) {
   address a = cast_from_oop<address>(o);
 #ifdef _LP64
   write_u8((u8)a);
@@ -537,7 +605,7 @@ void DumpWriter::write_objectID(oop o) {
 #endif
 }
 
-void DumpWriter::write_symbolID(Symbol* s) {
+void AbstractDumpWriter::write_symbolID(Symbol* s) {
   address a = (address)((uintptr_t)s);
 #ifdef _LP64
   write_u8((u8)a);
@@ -546,7 +614,7 @@ void DumpWriter::write_symbolID(Symbol* s) {
 #endif
 }
 
-void DumpWriter::write_id(u4 x) {
+void AbstractDumpWriter::write_id(u4 x) {
 #ifdef _LP64
   write_u8((u8) x);
 #else
@@ -555,11 +623,11 @@ void DumpWriter::write_id(u4 x) {
 }
 
 // We use java mirror as the class ID
-void DumpWriter::write_classID(Klass* k) {
+void AbstractDumpWriter::write_classID(Klass* k) {
   write_objectID(k->java_mirror());
 }
 
-void DumpWriter::finish_dump_segment() {
+void AbstractDumpWriter::finish_dump_segment() {
   if (_in_dump_segment) {
     assert(_sub_record_left == 0, "Last sub-record not written completely");
     assert(_sub_record_ended, "sub-record must have ended");
@@ -577,7 +645,7 @@ void DumpWriter::finish_dump_segment() {
   }
 }
 
-void DumpWriter::start_sub_record(u1 tag, u4 len) {
+void AbstractDumpWriter::start_sub_record(u1 tag, u4 len) {
   if (!_in_dump_segment) {
     if (position() > 0) {
       flush();
@@ -607,7 +675,7 @@ void DumpWriter::start_sub_record(u1 tag, u4 len) {
   write_u1(tag);
 }
 
-void DumpWriter::end_sub_record() {
+void AbstractDumpWriter::end_sub_record() {
   assert(_in_dump_segment, "must be in dump segment");
   assert(_sub_record_left == 0, "sub-record not written completely");
   assert(!_sub_record_ended, "Must not have ended yet");
@@ -620,7 +688,7 @@ class DumperSupport : AllStatic {
  public:
 
   // write a header of the given type
-  static void write_header(DumpWriter* writer, hprofTag tag, u4 len);
+  static void write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len);
 
   // returns hprof tag for the given type signature
   static hprofTag sig2tag(Symbol* sig);
@@ -633,42 +701,46 @@ class DumperSupport : AllStatic {
   static u4 instance_size(Klass* k);
 
   // dump a jfloat
-  static void dump_float(DumpWriter* writer, jfloat f);
+  static void dump_float(AbstractDumpWriter* writer, jfloat f);
   // dump a jdouble
-  static void dump_double(DumpWriter* writer, jdouble d);
+  static void dump_double(AbstractDumpWriter* writer, jdouble d);
   // dumps the raw value of the given field
-  static void dump_field_value(DumpWriter* writer, char type, oop obj, int offset);
+  static void dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset);
   // returns the size of the static fields; also counts the static fields
   static u4 get_static_fields_size(InstanceKlass* ik, u2& field_count);
   // dumps static fields of the given class
-  static void dump_static_fields(DumpWriter* writer, Klass* k);
+  static void dump_static_fields(AbstractDumpWriter* writer, Klass* k);
   // dump the raw values of the instance fields of the given object
-  static void dump_instance_fields(DumpWriter* writer, oop o);
+  static void dump_instance_fields(AbstractDumpWriter* writer, oop o);
   // get the count of the instance fields for a given class
   static u2 get_instance_fields_count(InstanceKlass* ik);
   // dumps the definition of the instance fields for a given class
-  static void dump_instance_field_descriptors(DumpWriter* writer, Klass* k);
+  static void dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_INSTANCE_DUMP record for the given object
-  static void dump_instance(DumpWriter* writer, oop o);
+  static void dump_instance(AbstractDumpWriter* writer, oop o);
   // creates HPROF_GC_CLASS_DUMP record for the given class and each of its
   // array classes
-  static void dump_class_and_array_classes(DumpWriter* writer, Klass* k);
+  static void dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_CLASS_DUMP record for a given primitive array
   // class (and each multi-dimensional array class too)
-  static void dump_basic_type_array_class(DumpWriter* writer, Klass* k);
+  static void dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k);
 
   // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-  static void dump_object_array(DumpWriter* writer, objArrayOop array);
+  static void dump_object_array(AbstractDumpWriter* writer, objArrayOop array);
   // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-  static void dump_prim_array(DumpWriter* writer, typeArrayOop array);
+  static void dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array);
   // create HPROF_FRAME record for the given method and bci
-  static void dump_stack_frame(DumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
+  static void dump_stack_frame(AbstractDumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
 
   // check if we need to truncate an array
-  static int calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size);
+  static int calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size);
+
+  // returns true if the sub-record for the given array does not fit into a
+  // single dump writer buffer (instances never do)
+  static bool is_huge_array(oop o);
 
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-  static void end_of_dump(DumpWriter* writer);
+  static void end_of_dump(AbstractDumpWriter* writer);
 
   static oop mask_dormant_archived_object(oop o) {
     if (o != NULL && o->klass()->java_mirror() == NULL) {
@@ -682,7 +754,7 @@ class DumperSupport : AllStatic {
 };
 
 // write a header of the given type
-void DumperSupport:: write_header(DumpWriter* writer, hprofTag tag, u4 len) {
+void DumperSupport:: write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len) {
   writer->write_u1((u1)tag);
   writer->write_u4(0);                  // current ticks
   writer->write_u4(len);
@@ -736,7 +808,7 @@ u4 DumperSupport::sig2size(Symbol* sig) {
 }
 
 // dump a jfloat
-void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
+void DumperSupport::dump_float(AbstractDumpWriter* writer, jfloat f) {
   if (g_isnan(f)) {
     writer->write_u4(0x7fc00000);    // collapsing NaNs
   } else {
@@ -750,7 +822,7 @@ void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
 }
 
 // dump a jdouble
-void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
+void DumperSupport::dump_double(AbstractDumpWriter* writer, jdouble d) {
   union {
     jlong l;
     double d;
@@ -765,7 +837,7 @@ void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
 }
 
 // dumps the raw value of the given field
-void DumperSupport::dump_field_value(DumpWriter* writer, char type, oop obj, int offset) {
+void DumperSupport::dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset) {
   switch (type) {
     case JVM_SIGNATURE_CLASS :
     case JVM_SIGNATURE_ARRAY : {
@@ -885,7 +957,7 @@ u4 DumperSupport::get_static_fields_size(InstanceKlass* ik, u2& field_count) {
 }
 
 // dumps static fields of the given class
-void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_static_fields(AbstractDumpWriter* writer, Klass* k) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(k);
 
@@ -929,7 +1001,7 @@ void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
 }
 
 // dump the raw values of the instance fields of the given object
-void DumperSupport::dump_instance_fields(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance_fields(AbstractDumpWriter* writer, oop o) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(o->klass());
 
@@ -954,7 +1026,7 @@ u2 DumperSupport::get_instance_fields_count(InstanceKlass* ik) {
 }
 
 // dumps the definition of the instance fields for a given class
-void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(k);
 
@@ -970,7 +1042,7 @@ void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k
 }
 
 // creates HPROF_GC_INSTANCE_DUMP record for the given object
-void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance(AbstractDumpWriter* writer, oop o) {
   InstanceKlass* ik = InstanceKlass::cast(o->klass());
   u4 is = instance_size(ik);
   u4 size = 1 + sizeof(address) + 4 + sizeof(address) + 4 + is;
@@ -993,7 +1065,7 @@ void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
 
 // creates HPROF_GC_CLASS_DUMP record for the given class and each of
 // its array classes
-void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k) {
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // We can safepoint and do a heap dump at a point where we have a Klass,
@@ -1082,7 +1154,7 @@ void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
 
 // creates HPROF_GC_CLASS_DUMP record for a given primitive array
 // class (and each multi-dimensional array class too)
-void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k) {
  // array classes
  while (k != NULL) {
     Klass* klass = k;
@@ -1117,7 +1189,7 @@ void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
 
 // Hprof uses an u4 as record length field,
 // which means we need to truncate arrays that are too long.
-int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size) {
+int DumperSupport::calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size) {
   BasicType type = ArrayKlass::cast(array->klass())->element_type();
   assert(type >= T_BOOLEAN && type <= T_OBJECT, "invalid array element type");
 
@@ -1143,8 +1215,23 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
   return length;
 }
 
+bool DumperSupport::is_huge_array(oop o) {
+  size_t size;
+  if (o->is_objArray()) {
+    // header of a HPROF_GC_OBJ_ARRAY_DUMP record, see dump_object_array()
+    size = 1 + 2 * 4 + 2 * sizeof(address) + (size_t)arrayOop(o)->length() * sizeof(address);
+  } else if (o->is_typeArray()) {
+    // header of a HPROF_GC_PRIM_ARRAY_DUMP record, see dump_prim_array()
+    BasicType type = TypeArrayKlass::cast(o->klass())->element_type();
+    size = 2 * 1 + 2 * 4 + sizeof(address) + (size_t)arrayOop(o)->length() * type2aelembytes(type);
+  } else {
+    return false;
+  }
+  return AbstractDumpWriter::is_huge_sub_record(size);
+}
+
 // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
+void DumperSupport::dump_object_array(AbstractDumpWriter* writer, objArrayOop array) {
   // sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID) + sizeof(classID)
   short header_size = 1 + 2 * 4 + 2 * sizeof(address);
   int length = calculate_array_max_length(writer, array, header_size);
@@ -1178,7 +1265,7 @@ void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
   for (int i = 0; i < Length; i++) { writer->write_##Size((Size)Array->Type##_at(i)); }
 
 // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
+void DumperSupport::dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array) {
   BasicType type = TypeArrayKlass::cast(array->klass())->element_type();
 
   // 2 * sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID)
@@ -1272,7 +1359,7 @@ void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
 }
 
 // create a HPROF_FRAME record of the given Method* and bci
-void DumperSupport::dump_stack_frame(DumpWriter* writer,
+void DumperSupport::dump_stack_frame(AbstractDumpWriter* writer,
                                      int frame_serial_num,
                                      int class_serial_num,
                                      Method* m,
@@ -1301,10 +1388,10 @@ void DumperSupport::dump_stack_frame(DumpWriter* writer,
 
 class SymbolTableDumper : public SymbolClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  SymbolTableDumper(DumpWriter* writer)     { _writer = writer; }
+  SymbolTableDumper(AbstractDumpWriter* writer) { _writer = writer; }
   void do_symbol(Symbol** p);
 };
 
@@ -1324,12 +1411,12 @@ void SymbolTableDumper::do_symbol(Symbol** p) {
 
 class JNILocalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
   u4 _thread_serial_num;
   int _frame_num;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  JNILocalsDumper(DumpWriter* writer, u4 thread_serial_num) {
+  JNILocalsDumper(AbstractDumpWriter* writer, u4 thread_serial_num) {
     _writer = writer;
     _thread_serial_num = thread_serial_num;
     _frame_num = -1;  // default - empty stack
@@ -1358,11 +1445,11 @@ void JNILocalsDumper::do_oop(oop* obj_p) {
 
 class JNIGlobalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
 
  public:
-  JNIGlobalsDumper(DumpWriter* writer) {
+  JNIGlobalsDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_oop(oop* obj_p);
@@ -1390,10 +1477,10 @@ void JNIGlobalsDumper::do_oop(oop* obj_p) {
 
 class MonitorUsedDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  MonitorUsedDumper(DumpWriter* writer) {
+  MonitorUsedDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_oop(oop* obj_p) {
@@ -1410,10 +1497,10 @@ class MonitorUsedDumper : public OopClosure {
 
 class StickyClassDumper : public KlassClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  StickyClassDumper(DumpWriter* writer) {
+  StickyClassDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_klass(Klass* k) {
@@ -1428,22 +1515,77 @@ class StickyClassDumper : public KlassClosure {
 };
 
 
-class VM_HeapDumper;
+// Objects whose sub-records are too large to be written by a parallel dumper
+// (see ParDumpWriter). The parallel dumpers push them here while walking the
+// heap; the VM thread dumps them through the global writer afterwards.
+class HeapDumpLargeObjectList : public CHeapObj<mtInternal> {
+ private:
+  class HeapDumpLargeObjectListElem : public CHeapObj<mtInternal> {
+   public:
+    HeapDumpLargeObjectListElem(oop obj) : _obj(obj), _next(NULL) { }
+    oop _obj;
+    HeapDumpLargeObjectListElem* _next;
+  };
+
+  HeapDumpLargeObjectListElem* volatile _head;
+
+ public:
+  HeapDumpLargeObjectList() : _head(NULL) { }
+
+  ~HeapDumpLargeObjectList() {
+    while (pop() != NULL) {
+      // Free all elements, dumped or not.
+    }
+  }
+
+  // Called concurrently by the parallel dumpers.
+  void atomic_push(oop obj) {
+    assert(obj != NULL, "sanity");
+    HeapDumpLargeObjectListElem* entry = new HeapDumpLargeObjectListElem(obj);
+    while (true) {
+      HeapDumpLargeObjectListElem* old_head = Atomic::load(&_head);
+      entry->_next = old_head;
+      if (Atomic::cmpxchg(&_head, old_head, entry) == old_head) {
+        break;
+      }
+    }
+  }
+
+  // Called by the VM thread only, after the parallel dumpers have finished.
+  oop pop() {
+    HeapDumpLargeObjectListElem* entry = _head;
+    if (entry == NULL) {
+      return NULL;
+    }
+    _head = entry->_next;
+    oop obj = entry->_obj;
+    delete entry;
+    return obj;
+  }
+
+  void drain(ObjectClosure* cl) {
+    oop obj;
+    while ((obj = pop()) != NULL) {
+      cl->do_object(obj);
+    }
+  }
+};
 
 // Support class using when iterating over the heap.
 
 class HeapObjectDumper : public ObjectClosure {
  private:
-  VM_HeapDumper* _dumper;
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
+  HeapDumpLargeObjectList* _list;
 
-  VM_HeapDumper* dumper()               { return _dumper; }
-  DumpWriter* writer()                  { return _writer; }
+  AbstractDumpWriter* writer()          { return _writer; }
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
-    _dumper = dumper;
+  // If list is not NULL, huge arrays are only recorded there and left
+  // for the caller to be dumped later.
+  HeapObjectDumper(AbstractDumpWriter* writer, HeapDumpLargeObjectList* list = NULL) {
     _writer = writer;
+    _list = list;
   }
 
   // called for each object in the heap
@@ -1463,6 +1605,11 @@ void HeapObjectDumper::do_object(oop o) {
     return;
   }
 
+  if (_list != NULL && DumperSupport::is_huge_array(o)) {
+    _list->atomic_push(o);
+    return;
+  }
+
   if (o->is_instance()) {
     // create a HPROF_GC_INSTANCE record for each object
     DumperSupport::dump_instance(writer(), o);
@@ -1475,6 +1622,59 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Coordinates the parallel heap dumpers. The dumpers running in the worker
+// gang wait until the VM thread has written everything that precedes the
+// object records, and the VM thread waits for all of them to finish before
+// it writes the remaining records.
+class DumperController : public CHeapObj<mtInternal> {
+ private:
+  bool     _started;
+  Monitor* _lock;
+  uint     _dumper_number;
+  uint     _complete_number;
+
+ public:
+  DumperController(uint number) :
+    _started(false),
+    _lock(new Monitor(Mutex::leaf, "Dumper Controller lock",
+                      true, Mutex::_safepoint_check_never)),
+    _dumper_number(number),
+    _complete_number(0) { }
+
+  ~DumperController() { delete _lock; }
+
+  void wait_for_start_signal() {
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    while (_started == false) {
+      ml.wait();
+    }
+    assert(_started == true, "dumper woke up with wrong state");
+  }
+
+  void start_dump() {
+    assert(_started == false, "start dump with wrong state");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    _started = true;
+    ml.notify_all();
+  }
+
+  void dumper_complete() {
+    assert(_started == true, "dumper complete with wrong state");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    _complete_number++;
+    ml.notify();
+  }
+
+  void wait_all_dumpers_complete() {
+    assert(_started == true, "wrong state when wait for dumper complete");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    while (_complete_number != _dumper_number) {
+      ml.wait();
+    }
+    _started = false;
+  }
+};
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
  private:
@@ -1488,6 +1688,27 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   ThreadStackTrace** _stack_traces;
   int _num_threads;
 
+  // parallel heap dump support
+  uint _num_dumper_threads;              // requested number of threads walking the heap
+  ParallelObjectIterator* _poi;
+  DumperController* _dumper_controller;
+  HeapDumpLargeObjectList* _large_object_list;
+  Mutex* _par_writer_lock;
+
+  // Sets up the parallel dump for a gang of the given number of workers.
+  // Falls back to a serial heap walk if the heap cannot be iterated in parallel.
+  void prepare_parallel_dump(uint num_active_workers);
+  void finish_parallel_dump();
+  bool is_parallel_dump() const       { return _num_dumper_threads > 1; }
+
+  // The gang workers with the lowest ids and the VM thread walk the heap,
+  // the other workers do the compression and writing.
+  bool is_dumper_worker(uint worker_id) const {
+    return is_parallel_dump() && worker_id < _num_dumper_threads - 1;
+  }
+  // Heap walk done by a parallel dumper (including the VM thread).
+  void dump_heap_objects_parallel(uint dumper_id);
+
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != NULL, "Error"); return _global_dumper; }
   static DumpWriter* writer()            {  assert(_global_writer != NULL, "Error"); return _global_writer; }
@@ -1528,7 +1749,7 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   void dump_stack_traces();
 
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1539,6 +1760,11 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
     _klass_map = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, true);
     _stack_traces = NULL;
     _num_threads = 0;
+    _num_dumper_threads = MAX2(num_dump_threads, 1u);
+    _poi = NULL;
+    _dumper_controller = NULL;
+    _large_object_list = NULL;
+    _par_writer_lock = NULL;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -1576,7 +1802,7 @@ bool VM_HeapDumper::skip_operation() const {
 }
 
 // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-void DumperSupport::end_of_dump(DumpWriter* writer) {
+void DumperSupport::end_of_dump(AbstractDumpWriter* writer) {
   writer->finish_dump_segment();
 
   writer->write_u1(HPROF_HEAP_DUMP_END);
@@ -1799,9 +2025,13 @@ void VM_HeapDumper::doit() {
   WorkGang* gang = ch->get_safepoint_workers();
 
   if (gang == NULL) {
+    // No workers to walk the heap in parallel.
+    _num_dumper_threads = 1;
     work(0);
   } else {
+    prepare_parallel_dump(gang->active_workers());
     gang->run_task(this, gang->active_workers(), true);
+    finish_parallel_dump();
   }
 
   // Now we clear the global variables, so that a future dumper can run.
@@ -1809,9 +2039,53 @@ void VM_HeapDumper::doit() {
   clear_global_writer();
 }
 
+void VM_HeapDumper::prepare_parallel_dump(uint num_active_workers) {
+  // Leave at least one worker for compressing and writing.
+  _num_dumper_threads = MIN2(_num_dumper_threads, num_active_workers);
+  if (!is_parallel_dump()) {
+    return;
+  }
+
+  _poi = Universe::heap()->parallel_object_iterator(_num_dumper_threads);
+  if (_poi == NULL) {
+    // Parallel iteration is not supported by this heap.
+    _num_dumper_threads = 1;
+    return;
+  }
+
+  // The global writer's backend lock is taken while holding this lock.
+  _par_writer_lock = new Mutex(Mutex::leaf + 1, "Parallel HProf writer lock",
+                               true, Mutex::_safepoint_check_never);
+  _dumper_controller = new DumperController(_num_dumper_threads - 1);
+  _large_object_list = new HeapDumpLargeObjectList();
+}
+
+void VM_HeapDumper::finish_parallel_dump() {
+  delete _poi;
+  delete _dumper_controller;
+  delete _large_object_list;
+  delete _par_writer_lock;
+  _poi = NULL;
+  _dumper_controller = NULL;
+  _large_object_list = NULL;
+  _par_writer_lock = NULL;
+}
+
+void VM_HeapDumper::dump_heap_objects_parallel(uint dumper_id) {
+  ParDumpWriter pw(writer(), _par_writer_lock);
+  HeapObjectDumper obj_dumper(&pw, _large_object_list);
+  _poi->object_iterate(&obj_dumper, dumper_id);
+}
+
 void VM_HeapDumper::work(uint worker_id) {
   if (!Thread::current()->is_VM_thread()) {
-    writer()->writer_loop();
+    if (is_dumper_worker(worker_id)) {
+      _dumper_controller->wait_for_start_signal();
+      dump_heap_objects_parallel(worker_id);
+      _dumper_controller->dumper_complete();
+    } else {
+      writer()->writer_loop();
+    }
     return;
   }
 
@@ -1853,8 +2127,23 @@ void VM_HeapDumper::work(uint worker_id) {
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->object_iterate(&obj_dumper);
+  if (!is_parallel_dump()) {
+    HeapObjectDumper obj_dumper(writer());
+    Universe::heap()->object_iterate(&obj_dumper);
+  } else {
+    // The parallel dumpers append complete segments to the global writer,
+    // so it must not be inside a segment itself.
+    writer()->finish_dump_segment();
+    _dumper_controller->start_dump();
+
+    // The VM thread takes part in the heap walk with the last dumper id.
+    dump_heap_objects_parallel(_num_dumper_threads - 1);
+    _dumper_controller->wait_all_dumpers_complete();
+
+    // Now dump the arrays that were too large for the parallel dumpers.
+    HeapObjectDumper obj_dumper(writer());
+    _large_object_list->drain(&obj_dumper);
+  }
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
@@ -1938,7 +2227,7 @@ void VM_HeapDumper::dump_stack_traces() {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, uint num_dump_threads) {
   assert(path != NULL && strlen(path) > 0, "path missing");
 
   // print message in interactive case
@@ -1973,7 +2262,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression) {
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
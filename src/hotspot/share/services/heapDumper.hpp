@@ -71,7 +71,8 @@ class HeapDumper : public StackObj {
   // dumps the heap to the specified file, returns 0 if success.
   // additional info is written to out if not NULL.
   // compression >= 0 creates a gzipped file with the given compression level.
-  int dump(const char* path, outputStream* out = NULL, int compression = -1);
+  // num_dump_threads > 1 walks the heap with that many threads if the heap supports it.
+  int dump(const char* path, outputStream* out = NULL, int compression = -1, uint num_dump_threads = 1);
 
   // returns error message (resource allocated), or NULL if no error
   char* error_as_C_string() const;
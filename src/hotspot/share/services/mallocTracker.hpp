@@ -43,20 +43,32 @@ class MemoryCounter {
   volatile size_t   _count;
   volatile size_t   _size;
 
+  // High-water mark of _size.
+  volatile size_t   _peak_size;
   DEBUG_ONLY(size_t   _peak_count;)
-  DEBUG_ONLY(size_t   _peak_size; )
+
+  inline void update_peak_size(size_t size) {
+    // On the malloc and realloc path: only a relaxed load unless the peak
+    // is raised. The peak is only a statistic, so no ordering is needed.
+    size_t peak = Atomic::load(&_peak_size);
+    while (size > peak) {
+      size_t fetched = Atomic::cmpxchg(&_peak_size, peak, size, memory_order_relaxed);
+      if (fetched == peak) {
+        break;
+      }
+      peak = fetched;
+    }
+  }
 
  public:
-  MemoryCounter() : _count(0), _size(0) {
+  MemoryCounter() : _count(0), _size(0), _peak_size(0) {
     DEBUG_ONLY(_peak_count = 0;)
-    DEBUG_ONLY(_peak_size  = 0;)
   }
 
   inline void allocate(size_t sz) {
     Atomic::inc(&_count);
     if (sz > 0) {
-      Atomic::add(&_size, sz);
-      DEBUG_ONLY(_peak_size = MAX2(_peak_size, _size));
+      update_peak_size(Atomic::add(&_size, sz));
     }
     DEBUG_ONLY(_peak_count = MAX2(_peak_count, _count);)
   }
@@ -73,15 +85,14 @@ class MemoryCounter {
   inline void resize(ssize_t sz) {
     if (sz != 0) {
       assert(sz >= 0 || _size >= size_t(-sz), "Must be");
-      Atomic::add(&_size, size_t(sz));
-      DEBUG_ONLY(_peak_size = MAX2(_size, _peak_size);)
+      update_peak_size(Atomic::add(&_size, size_t(sz)));
     }
   }
 
   inline size_t count() const { return _count; }
   inline size_t size()  const { return _size;  }
+  inline size_t peak_size()  const { return Atomic::load(&_peak_size); }
   DEBUG_ONLY(inline size_t peak_count() const { return _peak_count; })
-  DEBUG_ONLY(inline size_t peak_size()  const { return _peak_size; })
 
 };
 
@@ -122,6 +133,8 @@ class MallocMemory {
   inline size_t malloc_count() const { return _malloc.count();}
   inline size_t arena_size()   const { return _arena.size();  }
   inline size_t arena_count()  const { return _arena.count(); }
+  inline size_t malloc_peak_size() const { return _malloc.peak_size(); }
+  inline size_t arena_peak_size()  const { return _arena.peak_size(); }
 
   DEBUG_ONLY(inline const MemoryCounter& malloc_counter() const { return _malloc; })
   DEBUG_ONLY(inline const MemoryCounter& arena_counter()  const { return _arena;  })
@@ -25,6 +25,47 @@
 #include "precompiled.hpp"
 #include "utilities/utf8.hpp"
 
+// Most strings are entirely ASCII, and ASCII is encoded the same way in
+// modified UTF-8, Latin1 and UTF-16. The helpers below find the length of
+// the leading ASCII run eight bytes at a time, so that callers can copy it
+// in bulk before falling back to per-character conversion.
+
+static const uint64_t ascii_high_bits = UCONST64(0x8080808080808080);
+static const uint64_t ascii_low_bits  = UCONST64(0x0101010101010101);
+
+// Bytes in [0x00, 0x7F].
+static int leading_ascii_length(const char* str, int length) {
+  int i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t w;
+    memcpy(&w, str + i, sizeof(w));
+    if ((w & ascii_high_bits) != 0) {
+      break;
+    }
+  }
+  while (i < length && (unsigned char)str[i] <= 0x7F) {
+    i++;
+  }
+  return i;
+}
+
+// Bytes in [0x01, 0x7F]; 0x00 is two-byte encoded in modified UTF-8.
+static int leading_ascii_length(const jbyte* base, int length) {
+  int i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t w;
+    memcpy(&w, base + i, sizeof(w));
+    // The second test is non-zero if any byte of w is zero.
+    if ((w & ascii_high_bits) != 0 || ((w - ascii_low_bits) & ~w & ascii_high_bits) != 0) {
+      break;
+    }
+  }
+  while (i < length && base[i] >= 0x01) {
+    i++;
+  }
+  return i;
+}
+
 // Assume the utf8 string is in legal form and has been
 // checked in the class file parser/format checker.
 template<typename T> char* UTF8::next(const char* str, T* value) {
@@ -167,16 +208,15 @@ static u_char* utf8_write(u_char* base, jchar ch) {
 }
 
 template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unicode_str, int unicode_length) {
-  unsigned char ch;
   const char *ptr = utf8_str;
   int index = 0;
 
   /* ASCII case loop optimization */
-  for (; index < unicode_length; index++) {
-    if((ch = ptr[0]) > 0x7F) { break; }
-    unicode_str[index] = (T)ch;
-    ptr = (const char *)(ptr + 1);
+  const int ascii_length = leading_ascii_length(ptr, unicode_length);
+  for (; index < ascii_length; index++) {
+    unicode_str[index] = (T)(unsigned char)ptr[index];
   }
+  ptr += ascii_length;
 
   for (; index < unicode_length; index++) {
     ptr = UTF8::next(ptr, &unicode_str[index]);
@@ -460,7 +500,12 @@ char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
 
 char* UNICODE::as_utf8(const jbyte* base, int length, char* buf, int buflen) {
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  // Copy the leading ASCII characters in bulk, as many as fit.
+  int index = MAX2(0, MIN2(leading_ascii_length(base, length), buflen - 1));
+  memcpy(p, base, index);
+  p += index;
+  buflen -= index;
+  for (; index < length; index++) {
     jbyte c = base[index];
     int sz = utf8_size(c);
     buflen -= sz;
@@ -57,6 +57,14 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/* The maximum size of a malloc'ed buffer for reads. A read may return
+ * fewer bytes than requested, so larger requests are trimmed to this
+ * size: the buffer then stays in cache between the read and the copy
+ * into the Java array, and huge reads do not allocate and touch a
+ * buffer as large as the array on every call.
+ */
+#define MAX_MALLOC_SIZE (1024 * 1024)
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -92,6 +100,8 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return 0;
     } else if (len > BUF_SIZE) {
+        if (len > MAX_MALLOC_SIZE)
+            len = MAX_MALLOC_SIZE;
         buf = malloc(len);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
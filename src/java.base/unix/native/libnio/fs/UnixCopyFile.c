@@ -30,6 +30,10 @@
 #include <unistd.h>
 #include <errno.h>
 
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
+
 #include "sun_nio_fs_UnixCopyFile.h"
 
 #define RESTARTABLE(_cmd, _result) do { \
@@ -47,7 +51,8 @@ static void throwUnixException(JNIEnv* env, int errnum) {
 }
 
 /**
- * Transfer all bytes from src to dst via user-space buffers
+ * Transfer all bytes from src to dst, within the kernel where the
+ * platform supports it, and otherwise via user-space buffers
  */
 JNIEXPORT void JNICALL
 Java_sun_nio_fs_UnixCopyFile_transfer
@@ -56,6 +61,33 @@ Java_sun_nio_fs_UnixCopyFile_transfer
     char buf[8192];
     volatile jint* cancel = (jint*)jlong_to_ptr(cancelAddress);
 
+#if defined(__linux__)
+    // Transfer within the kernel, without copying through user space.
+    // When the copy can be cancelled, use chunks small enough to notice
+    // the request in time.
+    const size_t count = cancel != NULL ? 1048576 : 0x7ffff000;
+    ssize_t bytes_sent;
+    do {
+        RESTARTABLE(sendfile64((int)dst, (int)src, NULL, count), bytes_sent);
+        if (bytes_sent == -1) {
+            if (errno == EINVAL || errno == ENOSYS) {
+                // Not supported for these file types, copy via user-space
+                // buffers from the current position instead.
+                break;
+            }
+            throwUnixException(env, errno);
+            return;
+        }
+        if (cancel != NULL && *cancel != 0) {
+            throwUnixException(env, ECANCELED);
+            return;
+        }
+    } while (bytes_sent > 0);
+    if (bytes_sent == 0) {
+        return;
+    }
+#endif
+
     for (;;) {
         ssize_t n, pos, len;
         RESTARTABLE(read((int)src, &buf, sizeof(buf)), n);
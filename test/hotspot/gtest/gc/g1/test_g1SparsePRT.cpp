@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/sparsePRT.inline.hpp"
+#include "unittest.hpp"
+
+// Deleted entries are not reused before the table is cleared. Check that
+// adding and deleting entries for many regions does not grow the table
+// beyond what the live entries need once retired tables are freed.
+// @requires UseG1GC
+TEST_VM(G1SparsePRT, footprint_with_deleted_entries) {
+  if (!UseG1GC) {
+    return;
+  }
+
+  const RegionIdx_t num_live = 2;
+  const RegionIdx_t num_deleted = 10000;
+
+  SparsePRT sparse;
+  for (RegionIdx_t i = 0; i < num_live; i++) {
+    ASSERT_EQ(SparsePRT::added, sparse.add_card(i, 0));
+  }
+  for (RegionIdx_t i = num_live; i < num_live + num_deleted; i++) {
+    ASSERT_EQ(SparsePRT::added, sparse.add_card(i, 0));
+    ASSERT_TRUE(sparse.delete_entry(i));
+  }
+  sparse.free_retired_tables();
+
+  for (RegionIdx_t i = 0; i < num_live; i++) {
+    EXPECT_TRUE(sparse.contains_card(i, 0));
+    EXPECT_TRUE(sparse.contains_card_concurrent(i, 0));
+  }
+  for (RegionIdx_t i = num_live; i < num_live + num_deleted; i++) {
+    EXPECT_FALSE(sparse.contains_card(i, 0));
+  }
+
+  // A table that never had any entries deleted, with the same live entries.
+  SparsePRT expected;
+  for (RegionIdx_t i = 0; i < num_live; i++) {
+    ASSERT_EQ(SparsePRT::added, expected.add_card(i, 0));
+  }
+  EXPECT_EQ(expected.mem_size(), sparse.mem_size());
+}
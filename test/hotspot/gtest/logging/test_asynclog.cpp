@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logTestFixture.hpp"
+#include "logTestUtils.inline.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logFileOutput.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/globals.hpp"
+#include "unittest.hpp"
+
+// These tests drive AsyncLogWriter directly and only run when the VM has
+// been started with -Xlog:async, e.g. gtestLauncher -jdk:<jdk> -Xlog:async.
+class AsyncLogTest : public LogTestFixture {
+ protected:
+  const char* _output_name;
+  const char* _file;
+
+  AsyncLogTest() {
+    _output_name = prepend_prefix_temp_dir("file=", "asynclog-test.log");
+    _file = _output_name + strlen("file=");
+  }
+
+  ~AsyncLogTest() {
+    delete_file(_file);
+    os::free((void*)_output_name);
+  }
+
+  static AsyncLogWriter* writer() {
+    return AsyncLogWriter::instance();
+  }
+};
+
+TEST_VM_F(AsyncLogTest, enqueue) {
+  if (writer() == NULL) {
+    return;
+  }
+
+  {
+    LogFileOutput output(_output_name);
+    stringStream ss;
+    ASSERT_TRUE(output.initialize("", &ss)) << ss.as_string();
+
+    LogDecorations decorations(LogLevel::Info, LogTagSetMapping<LogTag::_logging>::tagset(), LogDecorators());
+    writer()->enqueue(output, decorations, "async message one");
+    writer()->enqueue(output, decorations, "async message two");
+    AsyncLogWriter::flush();
+  }
+
+  const char* expected[] = { "async message one", "async message two", NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(_file, expected));
+}
+
+TEST_VM_F(AsyncLogTest, enqueue_group) {
+  if (writer() == NULL) {
+    return;
+  }
+
+  {
+    LogFileOutput output(_output_name);
+    stringStream ss;
+    ASSERT_TRUE(output.initialize("", &ss)) << ss.as_string();
+
+    LogMessageBuffer msg;
+    msg.info("group line one");
+    msg.info("group line two");
+    msg.info("group line three");
+
+    LogDecorations decorations(LogLevel::Info, LogTagSetMapping<LogTag::_logging>::tagset(), LogDecorators());
+    writer()->enqueue(output, msg.iterator(LogLevel::Info, decorations));
+    AsyncLogWriter::flush();
+  }
+
+  const char* expected[] = { "group line one", "group line two", "group line three", NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(_file, expected));
+}
+
+// A group larger than the whole buffer can never be accepted, so none of its
+// lines may be written and all of them must be reported as dropped.
+TEST_VM_F(AsyncLogTest, drop_group) {
+  if (writer() == NULL) {
+    return;
+  }
+
+  const size_t line_length = 1000;
+  char* line = NEW_C_HEAP_ARRAY(char, line_length + 1, mtLogging);
+  memset(line, 'x', line_length);
+  line[line_length] = '\0';
+
+  {
+    LogFileOutput output(_output_name);
+    stringStream ss;
+    ASSERT_TRUE(output.initialize("", &ss)) << ss.as_string();
+
+    LogMessageBuffer msg;
+    msg.info("oversized group start");
+    for (size_t i = 0; i <= AsyncLogBufferSize / line_length; i++) {
+      msg.info("%s", line);
+    }
+    msg.info("oversized group end");
+
+    LogDecorations decorations(LogLevel::Info, LogTagSetMapping<LogTag::_logging>::tagset(), LogDecorators());
+    writer()->enqueue(output, msg.iterator(LogLevel::Info, decorations));
+    writer()->enqueue(output, decorations, "message after the group");
+    AsyncLogWriter::flush();
+  }
+  FREE_C_HEAP_ARRAY(char, line);
+
+  EXPECT_FALSE(file_contains_substring(_file, "oversized group start"));
+  EXPECT_FALSE(file_contains_substring(_file, "oversized group end"));
+  EXPECT_TRUE(file_contains_substring(_file, "message after the group"));
+  EXPECT_TRUE(file_contains_substring(_file, "messages dropped due to async logging"));
+}
+
+// Removing an output must write out the messages still pending for it.
+TEST_VM_F(AsyncLogTest, flush_on_reconfigure) {
+  if (writer() == NULL) {
+    return;
+  }
+
+  set_log_config(TestLogFileName, "logging=debug");
+  log_debug(logging)("pending before reconfiguration");
+  set_log_config(TestLogFileName, "all=off");
+
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "pending before reconfiguration"));
+}
@@ -230,3 +230,19 @@ TEST(LogDecorations, identifiers) {
     EXPECT_EQ(ids[i].expected, strtol(reported, NULL, 10));
   }
 }
+
+// Test that a copy owns its own decorations (required by asynchronous logging)
+TEST(LogDecorations, copy) {
+  LogDecorators decorator_selection;
+  ASSERT_TRUE(decorator_selection.parse("uptime,pid,tags"));
+  LogDecorations original(LogLevel::Warning, tagset, decorator_selection);
+  LogDecorations copy(original);
+
+  // The copy must not point into the buffer of the original
+  EXPECT_NE(original.decoration(LogDecorators::uptime_decorator), copy.decoration(LogDecorators::uptime_decorator));
+  EXPECT_STREQ(original.decoration(LogDecorators::uptime_decorator), copy.decoration(LogDecorators::uptime_decorator));
+  EXPECT_STREQ(original.decoration(LogDecorators::pid_decorator), copy.decoration(LogDecorators::pid_decorator));
+  EXPECT_STREQ(original.decoration(LogDecorators::tags_decorator), copy.decoration(LogDecorators::tags_decorator));
+  EXPECT_STREQ("warning", copy.decoration(LogDecorators::level_decorator));
+  EXPECT_TRUE(copy.decoration(LogDecorators::hostname_decorator) == NULL);
+}
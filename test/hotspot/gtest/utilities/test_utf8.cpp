@@ -48,3 +48,38 @@ TEST(utf8, length) {
   UNICODE::as_utf8(str, 19, res, INT_MAX);
   ASSERT_EQ(strlen(res), (size_t) 3 * 19) << "string should end here";
 }
+
+TEST(utf8, latin1_ascii_prefix) {
+  char res[64];
+  // 19 ASCII characters, then 0xE9 and 0x00, which both need two bytes
+  const char* ascii = "abcdefghijklmnopqrs";
+  jbyte str[21];
+  memcpy(str, ascii, 19);
+  str[19] = (jbyte) 0xE9;
+  str[20] = 0;
+
+  UNICODE::as_utf8(str, 21, res, sizeof(res));
+  ASSERT_EQ(strlen(res), (size_t) 23) << "ASCII prefix plus two 2-byte characters";
+  ASSERT_EQ(strncmp(res, ascii, 19), 0);
+  ASSERT_EQ((unsigned char) res[19], 0xC3);
+  ASSERT_EQ((unsigned char) res[20], 0xA9);
+  ASSERT_EQ((unsigned char) res[21], 0xC0);
+  ASSERT_EQ((unsigned char) res[22], 0x80);
+
+  UNICODE::as_utf8(str, 21, res, 11);
+  ASSERT_EQ(strlen(res), (size_t) 10) << "string should be truncated inside the ASCII prefix";
+
+  UNICODE::as_utf8(str, 21, res, 21);
+  ASSERT_EQ(strlen(res), (size_t) 19) << "string should be truncated before a 2-byte character";
+}
+
+TEST(utf8, convert_to_unicode_ascii_prefix) {
+  // 17 ASCII characters followed by U+00E9
+  const char* utf8 = "abcdefghijklmnopq\xC3\xA9";
+  jchar res[18];
+  UTF8::convert_to_unicode(utf8, res, 18);
+  for (int i = 0; i < 17; i++) {
+    ASSERT_EQ(res[i], (jchar) utf8[i]);
+  }
+  ASSERT_EQ(res[17], (jchar) 0xE9);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check disjoint byte copies on both sides of RepMovsbThreshold.
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:RepMovsbThreshold=64
+ *      compiler.arraycopy.TestByteCopyRepMovsb
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:RepMovsbThreshold=0
+ *      compiler.arraycopy.TestByteCopyRepMovsb
+ */
+
+package compiler.arraycopy;
+
+import java.util.Random;
+
+import jdk.internal.misc.Unsafe;
+
+public class TestByteCopyRepMovsb {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+
+    private static final int[] SIZES = { 0, 1, 7, 63, 64, 65, 2047, 2048, 2049, 4096 + 13, 1 << 20 };
+
+    private static void check(byte[] src, int srcPos, byte[] dst, int dstPos, int len, String what) {
+        for (int i = 0; i < dst.length; i++) {
+            byte expected = (i >= dstPos && i < dstPos + len) ? src[srcPos + i - dstPos] : 0;
+            if (dst[i] != expected) {
+                throw new RuntimeException(what + ": mismatch at " + i + " for srcPos=" + srcPos +
+                                           " dstPos=" + dstPos + " len=" + len);
+            }
+        }
+    }
+
+    private static void test(byte[] src, int srcPos, int dstPos, int len) {
+        byte[] dst = new byte[len + 32];
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+        check(src, srcPos, dst, dstPos, len, "System.arraycopy");
+
+        // An odd offset sends Unsafe.copyMemory to the byte copy stub
+        dst = new byte[len + 32];
+        UNSAFE.copyMemory(src, Unsafe.ARRAY_BYTE_BASE_OFFSET + srcPos,
+                          dst, Unsafe.ARRAY_BYTE_BASE_OFFSET + dstPos, len);
+        check(src, srcPos, dst, dstPos, len, "Unsafe.copyMemory");
+    }
+
+    public static void main(String[] args) {
+        byte[] src = new byte[(1 << 20) + 32];
+        new Random(42).nextBytes(src);
+        // Enough iterations for the compiled code to call the copy stubs
+        for (int iter = 0; iter < 2000; iter++) {
+            for (int len : SIZES) {
+                if (len > 8192 && iter % 500 != 0) {
+                    continue;
+                }
+                test(src, 1, 3, len);
+                test(src, 8, 8, len);
+                test(src, 5, 16, len);
+            }
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestInlineCacheBufferSize
+ * @summary Check that the VM starts with non-default values of
+ *          InlineCacheBufferSize and rejects values out of its range.
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver compiler.codecache.TestInlineCacheBufferSize
+ */
+
+package compiler.codecache;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestInlineCacheBufferSize {
+    private static OutputAnalyzer run(String size) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:InlineCacheBufferSize=" + size, "-Xcomp", "-version");
+        return new OutputAnalyzer(pb.start());
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Both ends of the range and a value in between. The code heap must
+        // have room for the larger buffers.
+        for (String size : new String[] { "1k", "64k", "1m" }) {
+            run(size).shouldHaveExitValue(0);
+        }
+
+        for (String size : new String[] { "0", "1023", "1048577", "16m" }) {
+            OutputAnalyzer output = run(size);
+            output.shouldContain("InlineCacheBufferSize=");
+            output.shouldContain("outside the allowed range");
+            output.shouldHaveExitValue(1);
+        }
+    }
+}
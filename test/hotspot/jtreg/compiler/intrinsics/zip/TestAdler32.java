@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check the Adler32 intrinsic against a reference implementation
+ *          for all buffer lengths around the vector and modulo boundaries.
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:+UseAdler32Intrinsics
+ *      compiler.intrinsics.zip.TestAdler32
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:-UseAdler32Intrinsics
+ *      compiler.intrinsics.zip.TestAdler32
+ */
+
+package compiler.intrinsics.zip;
+
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.Random;
+import java.util.zip.Adler32;
+
+public class TestAdler32 {
+    private static final int BASE = 65521;
+
+    private static long reference(long adler, byte[] b, int off, int len) {
+        long s1 = adler & 0xffff;
+        long s2 = adler >>> 16;
+        for (int i = off; i < off + len; i++) {
+            s1 = (s1 + (b[i] & 0xff)) % BASE;
+            s2 = (s2 + s1) % BASE;
+        }
+        return (s2 << 16) | s1;
+    }
+
+    private static void check(String what, int off, int len, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(what + " off=" + off + " len=" + len +
+                                       ": expected " + Long.toHexString(expected) +
+                                       ", got " + Long.toHexString(actual));
+        }
+    }
+
+    private static void test(byte[] data, ByteBuffer direct, int off, int len) {
+        long expected = reference(reference(1, data, 0, off), data, off, len);
+
+        Adler32 a = new Adler32();
+        a.update(data, 0, off);
+        a.update(data, off, len);
+        check("array", off, len, expected, a.getValue());
+
+        Adler32 b = new Adler32();
+        b.update(data, 0, off);
+        direct.limit(off + len).position(off);
+        b.update(direct);
+        check("direct buffer", off, len, expected, b.getValue());
+    }
+
+    public static void main(String[] args) {
+        // 5552 is the largest chunk the stub sums before reducing mod BASE
+        int[] lengths = { 0, 1, 15, 16, 17, 31, 32, 33, 255, 5551, 5552, 5553,
+                          5552 + 16, 2 * 5552 + 7, 65536, 1 << 20 };
+        int maxLen = 1 << 20;
+        byte[] data = new byte[maxLen + 64];
+
+        // All 0xff bytes give the largest intermediate sums
+        Arrays.fill(data, (byte)0xff);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data);
+        for (int iter = 0; iter < 200; iter++) {
+            for (int len : lengths) {
+                if (iter > 0 && len > 65536) {
+                    continue;
+                }
+                test(data, direct, iter % 16, len);
+            }
+        }
+
+        Random rnd = new Random(42);
+        rnd.nextBytes(data);
+        direct.clear();
+        direct.put(data);
+        for (int iter = 0; iter < 10000; iter++) {
+            int off = rnd.nextInt(64);
+            int len = rnd.nextInt(iter % 100 == 0 ? maxLen : 256);
+            test(data, direct, off, len);
+        }
+    }
+}
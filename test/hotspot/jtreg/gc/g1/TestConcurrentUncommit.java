@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestConcurrentUncommit
+ * @summary Check that the memory of regions removed by a heap shrink is
+ *          uncommitted by the concurrent uncommit thread.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UseG1GC -Xms8m -Xmx256m -XX:G1HeapRegionSize=1m
+ *      -XX:MinHeapFreeRatio=10 -XX:MaxHeapFreeRatio=20 -XX:-ExplicitGCInvokesConcurrent
+ *      -XX:+UnlockExperimentalVMOptions -XX:+G1UseConcurrentUncommit
+ *      -XX:NativeMemoryTracking=summary -Xlog:gc+heap=debug gc.g1.TestConcurrentUncommit
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.dcmd.JMXExecutor;
+
+public class TestConcurrentUncommit {
+    private static final Pattern HEAP_COMMITTED =
+        Pattern.compile("Java Heap \\(reserved=\\d+KB, committed=(\\d+)KB\\)");
+
+    private static List<byte[]> live = new ArrayList<>();
+
+    // The committed heap size as tracked by NMT, which is only updated when
+    // the memory is actually uncommitted.
+    private static long heapCommittedKB() {
+        String output = new JMXExecutor().execute("VM.native_memory summary").getStdout();
+        Matcher m = HEAP_COMMITTED.matcher(output);
+        if (!m.find()) {
+            throw new RuntimeException("No Java Heap entry in NMT summary:\n" + output);
+        }
+        return Long.parseLong(m.group(1));
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Expand the heap.
+        for (int i = 0; i < 160; i++) {
+            live.add(new byte[512 * 1024]);
+        }
+        System.gc();
+        long expanded = heapCommittedKB();
+        System.out.println("Committed after expansion: " + expanded + "KB");
+
+        // Shrink the heap. The pause only deactivates the removed regions.
+        live = null;
+        System.gc();
+
+        long committed = heapCommittedKB();
+        for (int i = 0; i < 100 && committed >= expanded / 2; i++) {
+            Thread.sleep(100);
+            committed = heapCommittedKB();
+        }
+        System.out.println("Committed after shrinking: " + committed + "KB");
+        if (committed >= expanded / 2) {
+            throw new RuntimeException("Heap memory not uncommitted: " + committed +
+                                       "KB committed, " + expanded + "KB before shrinking");
+        }
+    }
+}
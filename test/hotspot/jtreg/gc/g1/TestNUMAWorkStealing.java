@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestNUMAWorkStealing
+ * @summary Smoke test for G1 evacuation with NUMA enabled, where workers
+ *          prefer to steal work from workers on the same memory node.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:+UseNUMA -XX:ParallelGCThreads=8
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC
+ *      -Xms64m -Xmx64m -Xmn16m -Xlog:gc gc.g1.TestNUMAWorkStealing
+ */
+
+public class TestNUMAWorkStealing {
+    static class Node {
+        Node next;
+        Object payload;
+    }
+
+    private static final int Lists = 64;
+
+    public static void main(String[] args) throws Exception {
+        // Keep long linked lists alive across young collections, so that the
+        // evacuation work is unbalanced and workers have to steal.
+        Node[] heads = new Node[Lists];
+        for (int round = 0; round < 50; round++) {
+            for (int i = 0; i < Lists; i++) {
+                Node head = null;
+                for (int j = 0; j < 1000; j++) {
+                    Node n = new Node();
+                    n.next = head;
+                    n.payload = new byte[16];
+                    head = n;
+                }
+                heads[i] = head;
+            }
+        }
+        System.gc();
+
+        for (int i = 0; i < Lists; i++) {
+            int length = 0;
+            for (Node n = heads[i]; n != null; n = n.next) {
+                length++;
+            }
+            if (length != 1000) {
+                throw new RuntimeException("List " + i + " has " + length + " elements, expected 1000");
+            }
+        }
+    }
+}
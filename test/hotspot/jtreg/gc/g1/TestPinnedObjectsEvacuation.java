@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPinnedObjectsEvacuation
+ * @summary Check that G1 neither moves an array held in a JNI critical section
+ *          nor waits for the critical section to end before collecting, and
+ *          that hashed or locked objects next to it keep valid references.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UseG1GC -XX:+VerifyAfterGC -Xlog:gc gc.g1.TestPinnedObjectsEvacuation
+ */
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class TestPinnedObjectsEvacuation {
+    static { System.loadLibrary("TestPinnedObjectsEvacuation"); }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static native void pinInNative(int[] array);
+    private static native long pinnedAddress();
+    private static native long currentAddress(int[] array);
+    private static native void unpin();
+
+    static class Payload {
+        final int value;
+        Payload(int value) { this.value = value; }
+    }
+
+    // Objects allocated right after the pinned array, so they share its region.
+    private static Payload[] neighbours;
+
+    private static void checkNeighbours(Payload hashed, Payload locked, int hash) {
+        Asserts.assertTrue(neighbours[0] == hashed, "Reference to hashed object is broken");
+        Asserts.assertTrue(neighbours[1] == locked, "Reference to locked object is broken");
+        Asserts.assertEquals(neighbours[0].value, 1, "Hashed object has been modified");
+        Asserts.assertEquals(neighbours[1].value, 2, "Locked object has been modified");
+        Asserts.assertEquals(System.identityHashCode(neighbours[0]), hash, "Identity hash has changed");
+    }
+
+    private static void checkNotMoved(int[] array, long address) {
+        Asserts.assertEquals(currentAddress(array), address, "Pinned array has been moved");
+        for (int i = 0; i < array.length; i++) {
+            Asserts.assertEquals(array[i], i, "Pinned array has been modified");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        int[] array = new int[1024];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = i;
+        }
+        Payload hashed = new Payload(1);
+        Payload locked = new Payload(2);
+        neighbours = new Payload[] { hashed, locked };
+        int hash = System.identityHashCode(hashed);
+
+        Thread pinner = new Thread(() -> pinInNative(array));
+        pinner.start();
+
+        while (pinnedAddress() == 0) {
+            Thread.sleep(10);
+        }
+        long address = pinnedAddress();
+
+        try {
+            // The array starts out in an eden region, whose retention turns
+            // it into an old region for the following collections.
+            WB.youngGC();
+            checkNotMoved(array, address);
+            WB.youngGC();
+            checkNotMoved(array, address);
+            WB.fullGC();
+            checkNotMoved(array, address);
+            checkNeighbours(hashed, locked, hash);
+
+            // The mark words of the hashed and the locked object must not be
+            // taken for forwarding pointers by a full collection.
+            synchronized (locked) {
+                WB.fullGC();
+                checkNotMoved(array, address);
+                checkNeighbours(hashed, locked, hash);
+            }
+        } finally {
+            unpin();
+            pinner.join();
+        }
+
+        // Collections work as usual after the critical section ended.
+        WB.youngGC();
+        WB.fullGC();
+    }
+}
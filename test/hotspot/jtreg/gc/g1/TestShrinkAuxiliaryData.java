@@ -56,6 +56,8 @@ public class TestShrinkAuxiliaryData {
         "-XX:G1HeapRegionSize=" + REGION_SIZE,
         "-XX:-ExplicitGCInvokesConcurrent",
         "-Xlog:gc=debug",
+        "-XX:+UnlockExperimentalVMOptions",
+        "-XX:-G1UseConcurrentUncommit",
         "-XX:+UnlockDiagnosticVMOptions",
         "-XX:+WhiteBoxAPI",
         "--add-exports=java.base/jdk.internal.misc=ALL-UNNAMED",
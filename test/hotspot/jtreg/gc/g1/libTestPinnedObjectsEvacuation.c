@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native support for TestPinnedObjectsEvacuation test.
+ */
+
+#include "jni.h"
+
+#include <stdint.h>
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static volatile int release_critical = 0;
+static void* volatile pinned_address = NULL;
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinnedObjectsEvacuation_pinInNative(JNIEnv* env, jclass cls, jintArray array) {
+    void* native_array = (*env)->GetPrimitiveArrayCritical(env, array, 0);
+
+    if (native_array == NULL) {
+        return;
+    }
+
+    pinned_address = native_array;
+
+    while (!release_critical) {
+#ifdef WINDOWS
+        Sleep(1);
+#else
+        usleep(1000);
+#endif
+    }
+
+    (*env)->ReleasePrimitiveArrayCritical(env, array, native_array, 0);
+}
+
+JNIEXPORT jlong JNICALL
+Java_gc_g1_TestPinnedObjectsEvacuation_pinnedAddress(JNIEnv* env, jclass cls) {
+    return (jlong)(intptr_t)pinned_address;
+}
+
+JNIEXPORT jlong JNICALL
+Java_gc_g1_TestPinnedObjectsEvacuation_currentAddress(JNIEnv* env, jclass cls, jintArray array) {
+    void* native_array = (*env)->GetPrimitiveArrayCritical(env, array, 0);
+    (*env)->ReleasePrimitiveArrayCritical(env, array, native_array, JNI_ABORT);
+    return (jlong)(intptr_t)native_array;
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinnedObjectsEvacuation_unpin(JNIEnv* env, jclass cls) {
+    release_critical = 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
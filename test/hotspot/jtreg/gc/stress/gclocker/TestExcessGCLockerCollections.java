@@ -28,9 +28,7 @@ package gc.stress.gclocker;
  * @bug 8048556
  * @summary Check for GC Locker initiated GCs that immediately follow another
  * GC and so have very little needing to be collected.
- * @requires vm.gc != "Z"
- * @requires vm.gc != "Epsilon"
- * @requires vm.gc != "Shenandoah"
+ * @requires vm.gc == "Serial" | vm.gc == "Parallel"
  * @library /test/lib
  * @modules java.base/jdk.internal.misc
  * @run driver/timeout=1000 gc.stress.gclocker.TestExcessGCLockerCollections 300 4 2
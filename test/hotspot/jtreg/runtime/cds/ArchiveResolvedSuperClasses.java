@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Constant pool class entries resolved to a supertype of the pool
+ *          holder stay resolved in the archive with -XX:+ArchiveResolvedSuperClasses.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build ArchiveResolvedSuperClassesApp
+ * @run driver ClassFileInstaller -jar app.jar ArchiveResolvedSuperClassesApp
+ *             ArchiveResolvedSuperClassesApp$Parent ArchiveResolvedSuperClassesApp$Child
+ * @run driver ArchiveResolvedSuperClasses
+ */
+
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ArchiveResolvedSuperClasses {
+    // Logged when the Child constant pool entry for Parent is resolved by the
+    // instanceof in Child.isParent(). Resolution of supertypes during class
+    // loading and verification is logged with a "(super)" or "(verification)"
+    // suffix instead.
+    private static final Pattern RUNTIME_RESOLUTION = Pattern.compile(
+        "ArchiveResolvedSuperClassesApp\\$Child ArchiveResolvedSuperClassesApp\\$Parent " +
+        "ArchiveResolvedSuperClassesApp\\.java:\\d+$", Pattern.MULTILINE);
+
+    public static void main(String[] args) throws Exception {
+        // Without the flag, the entry is cleared when archived and is
+        // resolved again at runtime.
+        OutputAnalyzer output = dumpAndRun("cleared.jsa", "-XX:-ArchiveResolvedSuperClasses");
+        if (!RUNTIME_RESOLUTION.matcher(output.getStdout()).find()) {
+            throw new RuntimeException("Entry for Parent should be resolved at runtime");
+        }
+
+        // With the flag, the entry is archived resolved and is not resolved again.
+        output = dumpAndRun("resolved.jsa", "-XX:+ArchiveResolvedSuperClasses");
+        if (RUNTIME_RESOLUTION.matcher(output.getStdout()).find()) {
+            throw new RuntimeException("Entry for Parent should have been archived resolved");
+        }
+    }
+
+    private static OutputAnalyzer dumpAndRun(String archive, String flag) throws Exception {
+        // Record a dynamic archive, so that the entries resolved while the
+        // application runs are seen when the classes are archived.
+        OutputAnalyzer output = ProcessTools.executeTestJvm(
+            "-XX:+UnlockDiagnosticVMOptions", flag, "-Xint",
+            "-XX:ArchiveClassesAtExit=" + archive,
+            "-cp", "app.jar", "ArchiveResolvedSuperClassesApp");
+        output.shouldHaveExitValue(0);
+
+        output = ProcessTools.executeTestJvm(
+            "-XX:+UnlockDiagnosticVMOptions", flag, "-Xint",
+            "-XX:SharedArchiveFile=" + archive, "-Xshare:auto",
+            "-Xlog:class+load", "-Xlog:class+resolve=debug",
+            "-cp", "app.jar", "ArchiveResolvedSuperClassesApp");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("ArchiveResolvedSuperClassesApp$Child source: shared objects file (top)");
+        return output;
+    }
+}
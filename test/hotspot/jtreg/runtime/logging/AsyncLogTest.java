@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Tests -Xlog:async end to end, including dropped messages with a small buffer.
+ * @library /test/lib
+ * @run main AsyncLogTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AsyncLogTest {
+
+    static final String DROP_LINE = "messages dropped due to async logging";
+
+    // Log a modest amount of output that fits into the default buffer.
+    static void testOutput() throws Exception {
+        Path log = Paths.get("async-output.log");
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xlog:async",
+            "-Xlog:class+load=info:file=" + log,
+            "-version");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String contents = new String(Files.readAllBytes(log));
+        if (!contents.contains("java.lang.Object source:")) {
+            throw new RuntimeException("Expected class loading output in " + log);
+        }
+        if (contents.contains(DROP_LINE)) {
+            throw new RuntimeException("Unexpected dropped messages in " + log);
+        }
+    }
+
+    // Flood the smallest allowed buffer; the writer thread flushes every line
+    // and cannot keep up, so some messages must be reported as dropped.
+    static void testDropped() throws Exception {
+        Path log = Paths.get("async-dropped.log");
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xlog:async",
+            "-XX:AsyncLogBufferSize=100K",
+            "-Xlog:all=trace:file=" + log,
+            "-version");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String contents = new String(Files.readAllBytes(log));
+        if (!contents.contains("java.lang.Object source:")) {
+            throw new RuntimeException("Expected class loading output in " + log);
+        }
+        if (!contents.contains(DROP_LINE)) {
+            throw new RuntimeException("Expected '" + DROP_LINE + "' in " + log);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        testOutput();
+        testDropped();
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test id=G1
+ * @summary Test that GC.class_histogram -parallel counts the same instances as the serial walk
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC ClassHistogramParallelTest
+ */
+
+/*
+ * @test id=Parallel
+ * @summary Test that GC.class_histogram -parallel counts the same instances as the serial walk
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseParallelGC ClassHistogramParallelTest
+ */
+
+public class ClassHistogramParallelTest {
+    static class Small {}
+
+    static class Large {
+        long a, b, c, d, e, f, g, h;
+    }
+
+    private static final int SmallCount = 100_000;
+    private static final int LargeCount = 12_345;
+
+    // Spread over the heap, so that several workers find instances.
+    private static List<Object> live = new ArrayList<>();
+
+    static {
+        for (int i = 0; i < SmallCount; i++) {
+            live.add(new Small());
+            if (i < LargeCount) {
+                live.add(new Large());
+            }
+            // Garbage in between, removed by the full GC before inspection.
+            new Small();
+        }
+    }
+
+    private static long[] countAndBytes(OutputAnalyzer output, Class<?> c) {
+        Pattern p = Pattern.compile("^\\s*\\d+:\\s+(\\d+)\\s+(\\d+)\\s+" + Pattern.quote(c.getName()) + "\\s*$",
+                                    Pattern.MULTILINE);
+        Matcher m = p.matcher(output.getStdout());
+        Assert.assertTrue(m.find(), "No histogram entry for " + c.getName());
+        return new long[] { Long.parseLong(m.group(1)), Long.parseLong(m.group(2)) };
+    }
+
+    private static void compare(OutputAnalyzer serial, OutputAnalyzer parallel, Class<?> c, int expected) {
+        long[] s = countAndBytes(serial, c);
+        long[] p = countAndBytes(parallel, c);
+        Assert.assertEquals(s[0], expected, "Serial instance count of " + c.getName());
+        Assert.assertEquals(p[0], s[0], "Parallel instance count of " + c.getName());
+        Assert.assertEquals(p[1], s[1], "Parallel byte count of " + c.getName());
+    }
+
+    public void run(CommandExecutor executor) {
+        OutputAnalyzer serial = executor.execute("GC.class_histogram");
+        OutputAnalyzer parallel = executor.execute("GC.class_histogram -parallel=4");
+
+        compare(serial, parallel, Small.class, SmallCount);
+        compare(serial, parallel, Large.class, LargeCount);
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+
+    @Test
+    public void invalid() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.class_histogram -parallel=0");
+        output.shouldContain("Invalid number of parallel heap inspection threads: 0");
+    }
+}
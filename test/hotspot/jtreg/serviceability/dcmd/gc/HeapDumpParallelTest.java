@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test id=G1
+ * @summary Test of diagnostic command GC.heap_dump -parallel
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC HeapDumpParallelTest
+ */
+
+/*
+ * @test id=Parallel
+ * @summary Test of diagnostic command GC.heap_dump -parallel
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseParallelGC HeapDumpParallelTest
+ */
+
+public class HeapDumpParallelTest {
+    // Keeps enough objects alive that every dump thread gets some work.
+    private static List<Object> live;
+
+    private static void allocate() {
+        live = new ArrayList<>();
+        for (int i = 0; i < 100_000; i++) {
+            live.add(new int[i % 64]);
+            live.add("string " + i);
+        }
+        // Large enough to be deferred to the VM thread by the parallel dump.
+        live.add(new long[4 * 1024 * 1024]);
+    }
+
+    public void run(CommandExecutor executor, int threads) throws IOException {
+        allocate();
+        File dump = new File("jcmd.gc.heap_dump.parallel." + threads + "." + System.currentTimeMillis() + ".hprof");
+        if (dump.exists()) {
+            dump.delete();
+        }
+
+        OutputAnalyzer output = executor.execute("GC.heap_dump -parallel=" + threads + " " + dump.getAbsolutePath());
+        output.shouldContain("Heap dump file created");
+        verifyHeapDump(dump);
+        dump.delete();
+    }
+
+    private void verifyHeapDump(File dump) {
+        Assert.assertTrue(dump.exists() && dump.isFile(), "Could not create dump file " + dump.getAbsolutePath());
+        try {
+            File out = HprofParser.parse(dump);
+            Assert.assertTrue(out != null && out.exists() && out.isFile(), "Could not find hprof parser output file");
+            out.delete();
+        } catch (Exception e) {
+            e.printStackTrace();
+            Assert.fail("Could not parse dump file " + dump.getAbsolutePath());
+        }
+    }
+
+    @Test
+    public void jmx() throws IOException {
+        run(new JMXExecutor(), 4);
+    }
+
+    @Test
+    public void cli() throws IOException {
+        run(new PidJcmdExecutor(), 4);
+    }
+
+    @Test
+    public void serial() throws IOException {
+        run(new PidJcmdExecutor(), 1);
+    }
+
+    @Test
+    public void invalid() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.heap_dump -parallel=0 unused.hprof");
+        output.shouldContain("Invalid number of parallel dump threads: 0");
+    }
+}
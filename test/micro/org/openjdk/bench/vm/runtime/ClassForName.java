@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Exercises class resolution through the SystemDictionary, together with the
+ * SymbolTable lookups of the class names.
+ *
+ * Run with -t 1,2,4,...,256 to see how resolution scales with the number of
+ * threads.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class ClassForName {
+
+    /** Number of distinct missing class names looked up. Must be positive. */
+    @Param({"1024"})
+    private int size;
+
+    private String[] missing;
+
+    private final Lookup lookup = new Lookup();
+
+    /** Exposes findLoadedClass(), which does not throw for missing classes. */
+    static class Lookup extends ClassLoader {
+        Lookup() {
+            super(null);
+        }
+
+        Class<?> find(String name) {
+            return findLoadedClass(name);
+        }
+    }
+
+    @Setup
+    public void setup() {
+        missing = new String[size];
+        for (int i = 0; i < size; i++) {
+            missing[i] = "org.openjdk.bench.vm.runtime.Missing" + i;
+        }
+    }
+
+    @State(Scope.Thread)
+    public static class ThreadState {
+        int index;
+    }
+
+    /** Resolves an already loaded, initialized class. */
+    @Benchmark
+    public Class<?> forNameLoaded() throws ClassNotFoundException {
+        return Class.forName("java.lang.String");
+    }
+
+    /**
+     * Looks up a class that does not exist. Class.forName() would spend most
+     * of its time creating the ClassNotFoundException, so this asks the
+     * SystemDictionary directly. The names come from a fixed pool, so the
+     * SymbolTable does not grow.
+     */
+    @Benchmark
+    public Class<?> findMissing(ThreadState ts) {
+        int i = ts.index;
+        ts.index = (i + 1) % size;
+        return lookup.find(missing[i]);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Exercises ObjectSynchronizer: every operation inflates the monitor of a
+ * fresh object, leaving it to be deflated by the VM later on.
+ *
+ * Run with -t 1,2,4,...,256 to see how inflation and deflation scale with
+ * the number of threads.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class MonitorInflation {
+
+    private final Object shared = new Object();
+
+    /** Hashing a stack-locked object inflates its monitor. */
+    @Benchmark
+    public int inflateByHashCode() {
+        Object o = new Object();
+        synchronized (o) {
+            return System.identityHashCode(o);
+        }
+    }
+
+    /** Waiting on an object requires an inflated monitor. */
+    @Benchmark
+    public Object inflateByWait() throws InterruptedException {
+        Object o = new Object();
+        synchronized (o) {
+            o.wait(0, 1);
+        }
+        return o;
+    }
+
+    /** All threads lock the same object; contention keeps it inflated. */
+    @Benchmark
+    public void contendedLock() {
+        synchronized (shared) {
+            // Empty
+        }
+    }
+}
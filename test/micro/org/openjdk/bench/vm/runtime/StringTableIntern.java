@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Exercises StringTable::intern, both for strings already in the table and
+ * for new strings that have to be added to it.
+ *
+ * Both benchmarks use a fixed pool of size strings, so the table does not
+ * grow beyond that. The StringTable refers to interned strings weakly, and
+ * internNew interns copies that nothing else keeps alive. A copy is removed
+ * from the table once a GC finds it unreachable, and its name is then new
+ * again. Choose size large enough that a name is rarely reused between GCs.
+ *
+ * Run with -t 1,2,4,...,256 to see how the table scales with the number of
+ * threads.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class StringTableIntern {
+
+    /** Number of distinct strings in each pool. Must be positive. */
+    @Param({"1024", "1048576"})
+    private int size;
+
+    private String[] known;
+
+    private String[] fresh;
+
+    @Setup
+    public void setup() {
+        known = new String[size];
+        fresh = new String[size];
+        for (int i = 0; i < size; i++) {
+            known[i] = ("known" + i).intern();
+            fresh[i] = "new" + i;
+        }
+    }
+
+    @State(Scope.Thread)
+    public static class ThreadState {
+        int index;
+    }
+
+    @Benchmark
+    public String internExisting(ThreadState ts) {
+        int i = ts.index;
+        ts.index = (i + 1) % size;
+        return new String(known[i]).intern();
+    }
+
+    @Benchmark
+    public String internNew(ThreadState ts) {
+        int i = ts.index;
+        ts.index = (i + 1) % size;
+        return new String(fresh[i]).intern();
+    }
+}